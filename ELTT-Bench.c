@@ -0,0 +1,541 @@
+/* ELTT-Bench.c
+ *
+ * Mikrobenchmark-Harness für die heißen Pfade der Engine:
+ * Block-Anhängen, SHA-256-Batch, Validator (seriell/parallel),
+ * Viewer-Grid, Aktivitätsindex und Energie-Berechnung.
+ *
+ * Der Workload kommt deterministisch aus ELTT-Workload.c; gleiche
+ * Parameter ergeben gleiche Chains, Messreihen sind damit zwischen
+ * Releases vergleichbar. Ausgabe: eine JSON-Zeile pro Messung
+ * (maschinenlesbar, eine Zeile = ein Datenpunkt).
+ *
+ * Aufruf:
+ *   eltt-bench [blocks] [txs_per_block] [wallets] [reuse_ratio] [seed]
+ *
+ * Bauen:  make bench
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* ----------------------------------------------------------
+ * Gemeinsame Typen (müssen mit ELTT-Blockchain.c übereinstimmen)
+ * ---------------------------------------------------------- */
+
+#define ELTT_MAX_TOKEN_SYMBOL_LEN 16
+#define ELTT_MAX_TOKEN_NAME_LEN   64
+#define ELTT_MAX_ADDRESS_LEN      64
+#define ELTT_MAX_MEMO_LEN         128
+#define ELTT_MAX_TOKEN_TYPES      64
+#define ELTT_MAX_TX_PER_BLOCK     256
+#define ELTT_MAX_WALLETS          1024
+#define ELTT_MAX_POOLS            256
+#define ELTT_MAX_STAKES           1024
+#define ELTT_WALLET_INDEX_CAP     2048
+#define ELTT_INTERN_MAX_IDS       16384
+
+/* Festkomma-Guthaben: muss mit ELTT-Blockchain.c übereinstimmen. */
+typedef int64_t eltt_amount_fp;
+#define ELTT_FP_SCALE 100000000LL
+#define ELTT_BLOCKS_PER_CHUNK     64
+#define ELTT_MAX_BLOCK_CHUNKS     8192
+#define ELTT_TX_CHUNK_CAP         4096
+#define ELTT_MAX_TX_CHUNKS        4096
+
+typedef enum {
+    ELTT_TOKEN_KIND_TTTC,
+    ELTT_TOKEN_KIND_ELTT,
+    ELTT_TOKEN_KIND_ELTC,
+    ELTT_TOKEN_KIND_GENERIC,
+    ELTT_TOKEN_KIND_LP
+} eltt_token_kind;
+
+typedef struct {
+    char  name[ELTT_MAX_TOKEN_NAME_LEN];
+    char  symbol[ELTT_MAX_TOKEN_SYMBOL_LEN];
+    int   decimals;
+    eltt_token_kind kind;
+    double energy_binding_factor;
+} eltt_token_type;
+
+typedef struct {
+    char  address[ELTT_MAX_ADDRESS_LEN];
+} eltt_wallet;
+
+typedef enum {
+    ELTT_TX_KIND_TRANSFER,
+    ELTT_TX_KIND_MINT,
+    ELTT_TX_KIND_BURN,
+    ELTT_TX_KIND_CREATE_TOKEN,
+    ELTT_TX_KIND_CREATE_POOL,
+    ELTT_TX_KIND_ADD_LIQUIDITY,
+    ELTT_TX_KIND_REMOVE_LIQUIDITY,
+    ELTT_TX_KIND_STAKE,
+    ELTT_TX_KIND_UNSTAKE,
+    ELTT_TX_KIND_CLAIM_REWARDS,
+    ELTT_TX_KIND_SWAP,
+    ELTT_TX_KIND_PROFILE_UPDATE,
+    ELTT_TX_KIND_GOVERNANCE_PROPOSAL
+} eltt_tx_kind;
+
+typedef struct {
+    char  from[ELTT_MAX_ADDRESS_LEN];
+    char  to[ELTT_MAX_ADDRESS_LEN];
+    double amount;
+    int   token_index;
+    eltt_tx_kind kind;
+    char  memo[ELTT_MAX_MEMO_LEN];
+    /* Interning-Cache (siehe ELTT-Blockchain.c): prozess-lokal,
+     * nicht Teil des Wire-Formats; 0 = nicht interniert. */
+    uint32_t from_id;
+    uint32_t to_id;
+} eltt_transaction;
+
+typedef struct {
+    uint32_t index;
+    uint64_t timestamp;
+    uint8_t  prev_hash[32];
+    uint8_t  hash[32];
+    /* Merkle-Wurzel über die serialisierten Transaktionen des Blocks */
+    uint8_t  merkle_root[32];
+    size_t   tx_count;
+    eltt_transaction *txs;
+} eltt_block;
+
+typedef struct {
+    int token_x_index;
+    int token_y_index;
+    double reserve_x;
+    double reserve_y;
+    int lp_token_index;
+} eltt_liquidity_pool;
+
+typedef struct {
+    char  owner[ELTT_MAX_ADDRESS_LEN];
+    int   token_index;
+    double amount;
+    uint64_t start_timestamp;
+    uint64_t lock_until;
+    double accumulated_rewards;
+    /* Akkumulator-Snapshot, siehe ELTT-Blockchain.c */
+    double reward_per_token_snap;
+} eltt_staking_position;
+
+/* Teilzustände mit eigenem Generationszähler (muss mit
+ * ELTT-Blockchain.c übereinstimmen). */
+typedef enum {
+    ELTT_VIEW_CHAIN = 0,
+    ELTT_VIEW_WALLETS,
+    ELTT_VIEW_POOLS,
+    ELTT_VIEW_STAKES,
+    ELTT_VIEW_COUNT
+} eltt_view_kind;
+
+/* Materialisierte Pool-Ansicht (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    int pool_index;
+    int token_x_index;
+    int token_y_index;
+    double reserve_x;
+    double reserve_y;
+    int lp_token_index;
+} eltt_pool_view_entry;
+
+/* Posting-Liste für Wallet-Aktivität
+ * (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    uint32_t block_index;
+    uint32_t tx_index;
+} eltt_tx_ref;
+
+typedef struct {
+    size_t count;
+    size_t cap;
+    eltt_tx_ref *refs;
+} eltt_activity_list;
+
+typedef struct {
+    size_t block_count;
+    eltt_block *block_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    uint8_t *bloom_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    size_t tx_chunk_count;
+    size_t tx_chunk_used;
+    eltt_transaction *tx_chunks[ELTT_MAX_TX_CHUNKS];
+    size_t wallet_count;
+    eltt_wallet wallets[ELTT_MAX_WALLETS];
+    /* Guthaben token-major (Struct-of-Arrays), siehe ELTT-Blockchain.c */
+    eltt_amount_fp wallet_balances[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_WALLETS];
+    size_t token_count;
+    eltt_token_type token_types[ELTT_MAX_TOKEN_TYPES];
+    size_t pool_count;
+    eltt_liquidity_pool pools[ELTT_MAX_POOLS];
+    size_t stake_count;
+    eltt_staking_position stakes[ELTT_MAX_STAKES];
+    /* Staking-Reward-Akkumulatoren, siehe ELTT-Blockchain.c */
+    double   stake_reward_per_token[ELTT_MAX_TOKEN_TYPES];
+    uint64_t stake_accrual_timestamp;
+    int32_t wallet_index_map[ELTT_WALLET_INDEX_CAP];
+    /* Direkt-Map Intern-ID -> Wallet-Index, siehe ELTT-Blockchain.c */
+    int32_t id_to_wallet[ELTT_INTERN_MAX_IDS + 1];
+    /* Generationszähler und materialisierte Pool-Ansicht,
+     * siehe ELTT-Blockchain.c */
+    uint64_t view_generations[ELTT_VIEW_COUNT];
+    size_t pool_view_count;
+    eltt_pool_view_entry pool_view[ELTT_MAX_POOLS];
+    /* Aktivitäts-Index, siehe ELTT-Blockchain.c */
+    eltt_activity_list activity[ELTT_MAX_WALLETS];
+} eltt_blockchain;
+
+/* Viewer-Typen (müssen mit ELTT-Viewer.c übereinstimmen) */
+typedef struct {
+    uint32_t index;
+    uint64_t timestamp;
+    uint8_t  hash[32];
+    uint8_t  prev_hash[32];
+    size_t   tx_count;
+} eltt_chain_grid_entry;
+
+/* Fehlercodes des Validators (müssen mit ELTT-Vallidator.c übereinstimmen) */
+typedef enum {
+    ELTT_VALIDATOR_OK = 0,
+
+    /* Struktur / Basis */
+    ELTT_VALIDATOR_ERR_NULL_BLOCKCHAIN,
+    ELTT_VALIDATOR_ERR_NO_BLOCKS,
+
+    /* Genesis / Chain */
+    ELTT_VALIDATOR_ERR_GENESIS_PREV_HASH,
+    ELTT_VALIDATOR_ERR_BLOCK_INDEX_SEQUENCE,
+    ELTT_VALIDATOR_ERR_BLOCK_PREV_HASH_MISMATCH,
+    ELTT_VALIDATOR_ERR_BLOCK_HASH_MISMATCH,
+    ELTT_VALIDATOR_ERR_BLOCK_MERKLE_MISMATCH,
+    ELTT_VALIDATOR_ERR_TIMESTAMP_NON_MONOTONIC,
+
+    /* Token / Wallet / Pools / Stakes */
+    ELTT_VALIDATOR_ERR_TOKEN_SYMBOL_DUPLICATE,
+    ELTT_VALIDATOR_ERR_WALLET_ADDRESS_INVALID,
+    ELTT_VALIDATOR_ERR_WALLET_BALANCE_NEGATIVE,
+    ELTT_VALIDATOR_ERR_POOL_INDEX_INVALID,
+    ELTT_VALIDATOR_ERR_POOL_RESERVE_NEGATIVE,
+    ELTT_VALIDATOR_ERR_STAKE_OWNER_INVALID,
+    ELTT_VALIDATOR_ERR_STAKE_AMOUNT_NEGATIVE,
+    ELTT_VALIDATOR_ERR_STAKE_TIME_INCONSISTENT,
+
+    /* Transaktionen */
+    ELTT_VALIDATOR_ERR_TX_TOKEN_INDEX_INVALID,
+    ELTT_VALIDATOR_ERR_TX_AMOUNT_NEGATIVE,
+    ELTT_VALIDATOR_ERR_TX_KIND_INVALID,
+    ELTT_VALIDATOR_ERR_TX_REPLAY_DUPLICATE_IN_BLOCK,
+
+    /* Reserviert für Erweiterungen */
+    ELTT_VALIDATOR_ERR_UNKNOWN
+} eltt_validator_error;
+
+
+/* Workload-Parameter (müssen mit ELTT-Workload.c übereinstimmen) */
+typedef struct {
+    uint64_t seed;
+    size_t   block_count;
+    size_t   txs_per_block;
+    size_t   wallet_cardinality;
+    double   address_reuse_ratio;
+} eltt_workload_params;
+
+/* ----------------------------------------------------------
+ * Externe Funktionen
+ * ---------------------------------------------------------- */
+
+void eltt_blockchain_init(eltt_blockchain *bc);
+void eltt_blockchain_free(eltt_blockchain *bc);
+const eltt_block *eltt_blockchain_get_block(const eltt_blockchain *bc, size_t i);
+double eltt_blockchain_compute_tx_energy(const eltt_transaction *tx);
+size_t eltt_blockchain_prewarm_energy_cache(const eltt_blockchain *bc,
+                                            size_t first_block,
+                                            size_t last_block);
+void eltt_blockchain_energy_cache_reset(void);
+void eltt_sha256_many(const uint8_t **msgs, const size_t *lens,
+                      size_t n, uint8_t (*out)[32]);
+const char *eltt_sha256_backend_name(void);
+size_t eltt_blockchain_wallet_activity(const eltt_blockchain *bc,
+                                       const char *wallet_address,
+                                       size_t offset, size_t max_entries,
+                                       eltt_transaction *out_txs,
+                                       uint32_t *out_block_indices);
+
+int eltt_validator_check_blockchain(const eltt_blockchain *bc,
+                                    eltt_validator_error *out_err);
+int eltt_validator_check_blockchain_parallel(const eltt_blockchain *bc,
+                                             size_t num_threads,
+                                             eltt_validator_error *out_err);
+
+size_t eltt_viewer_build_chain_grid(const eltt_blockchain *bc,
+                                    eltt_chain_grid_entry *out_entries,
+                                    size_t max_entries);
+
+void eltt_workload_block_txs(const eltt_workload_params *p,
+                             size_t block_index,
+                             eltt_transaction *out_txs,
+                             size_t *out_count);
+int eltt_workload_build_chain(const eltt_workload_params *p, eltt_blockchain *bc);
+
+/* JSON-Writer (muss mit ELTT-Json-Writer.c übereinstimmen) */
+typedef struct {
+    char  *buf;
+    size_t len;
+    size_t cap;
+    int    owns_buf;
+    int    error;
+} eltt_json_writer;
+
+extern void eltt_json_writer_init(eltt_json_writer *w);
+extern void eltt_json_writer_free(eltt_json_writer *w);
+extern const char *eltt_json_writer_cstr(const eltt_json_writer *w);
+extern void eltt_json_append_char(eltt_json_writer *w, char c);
+extern void eltt_json_field_string(eltt_json_writer *w, const char *key, const char *value);
+extern void eltt_json_field_int(eltt_json_writer *w, const char *key, long long v);
+extern void eltt_json_field_double(eltt_json_writer *w, const char *key, double v);
+
+/* ----------------------------------------------------------
+ * Zeit- und Zyklenmessung
+ * ---------------------------------------------------------- */
+
+static double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    /* Ohne TSC: Nanosekunden als Ersatz, cycles_per_op ist dann
+     * ns_per_op. */
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* Eine Messung als JSON-Zeile:
+ * {"bench":"...","ops":N,"seconds":s,"ns_per_op":x,"cycles_per_op":y,...} */
+static void bench_report(const char *name, size_t ops,
+                         double seconds, uint64_t cycles)
+{
+    eltt_json_writer w;
+    eltt_json_writer_init(&w);
+    eltt_json_append_char(&w, '{');
+    eltt_json_field_string(&w, "bench", name);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_int(&w, "ops", (long long)ops);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "seconds", seconds);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "ns_per_op",
+                           (ops > 0) ? seconds * 1e9 / (double)ops : 0.0);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "cycles_per_op",
+                           (ops > 0) ? (double)cycles / (double)ops : 0.0);
+    eltt_json_append_char(&w, '}');
+    printf("%s\n", eltt_json_writer_cstr(&w));
+    eltt_json_writer_free(&w);
+}
+
+/* ----------------------------------------------------------
+ * Einzel-Benchmarks
+ * ---------------------------------------------------------- */
+
+static size_t bench_append(const eltt_workload_params *p, eltt_blockchain *bc)
+{
+    double t0 = bench_now();
+    uint64_t c0 = bench_cycles();
+    if (!eltt_workload_build_chain(p, bc)) {
+        fprintf(stderr, "eltt-bench: workload chain rejected\n");
+        exit(1);
+    }
+    uint64_t c1 = bench_cycles();
+    double t1 = bench_now();
+    bench_report("append_block", p->block_count, t1 - t0, c1 - c0);
+    return p->block_count * p->txs_per_block;
+}
+
+static void bench_sha256(const eltt_workload_params *p)
+{
+    /* Batch über txs_per_block serialisierte Transaktionsgrößen —
+     * derselbe Längenbereich wie im Hash-Pfad der Engine. */
+    size_t n = p->txs_per_block;
+    if (n == 0) {
+        n = 1;
+    }
+    eltt_transaction *txs = malloc(n * sizeof(*txs));
+    const uint8_t **msgs = malloc(n * sizeof(*msgs));
+    size_t *lens = malloc(n * sizeof(*lens));
+    uint8_t (*digests)[32] = malloc(n * 32);
+    if (!txs || !msgs || !lens || !digests) {
+        fprintf(stderr, "eltt-bench: out of memory\n");
+        exit(1);
+    }
+    size_t filled;
+    eltt_workload_block_txs(p, 1, txs, &filled);
+    if (filled == 0) {
+        /* txs_per_block == 0: der Workload liefert nichts — eine
+         * Null-Transaktion als Füllmuster, sonst teilt i % filled
+         * durch null. */
+        memset(&txs[0], 0, sizeof(txs[0]));
+        filled = 1;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        msgs[i] = (const uint8_t *)&txs[i % filled];
+        lens[i] = sizeof(eltt_transaction);
+    }
+    size_t rounds = 2000;
+    double t0 = bench_now();
+    uint64_t c0 = bench_cycles();
+    for (size_t r = 0; r < rounds; ++r) {
+        eltt_sha256_many(msgs, lens, n, digests);
+    }
+    uint64_t c1 = bench_cycles();
+    double t1 = bench_now();
+    bench_report("sha256_many", rounds * n, t1 - t0, c1 - c0);
+    free(txs);
+    free(msgs);
+    free(lens);
+    free(digests);
+}
+
+static void bench_validator(const eltt_blockchain *bc)
+{
+    eltt_validator_error err = 0;
+    double t0 = bench_now();
+    uint64_t c0 = bench_cycles();
+    int ok = eltt_validator_check_blockchain(bc, &err);
+    uint64_t c1 = bench_cycles();
+    double t1 = bench_now();
+    if (!ok) {
+        fprintf(stderr, "eltt-bench: validator rejected chain (err=%d)\n", err);
+        exit(1);
+    }
+    bench_report("validator_full", bc->block_count, t1 - t0, c1 - c0);
+
+    t0 = bench_now();
+    c0 = bench_cycles();
+    ok = eltt_validator_check_blockchain_parallel(bc, 4, &err);
+    c1 = bench_cycles();
+    t1 = bench_now();
+    if (!ok) {
+        fprintf(stderr, "eltt-bench: parallel validator rejected chain (err=%d)\n", err);
+        exit(1);
+    }
+    bench_report("validator_parallel4", bc->block_count, t1 - t0, c1 - c0);
+}
+
+static void bench_viewer_grid(const eltt_blockchain *bc)
+{
+    eltt_chain_grid_entry *grid = malloc(bc->block_count * sizeof(*grid));
+    if (!grid) {
+        fprintf(stderr, "eltt-bench: out of memory\n");
+        exit(1);
+    }
+    size_t rounds = 200;
+    size_t built = 0;
+    double t0 = bench_now();
+    uint64_t c0 = bench_cycles();
+    for (size_t r = 0; r < rounds; ++r) {
+        built = eltt_viewer_build_chain_grid(bc, grid, bc->block_count);
+    }
+    uint64_t c1 = bench_cycles();
+    double t1 = bench_now();
+    bench_report("viewer_chain_grid", rounds * built, t1 - t0, c1 - c0);
+    free(grid);
+}
+
+static void bench_activity(const eltt_blockchain *bc)
+{
+    eltt_transaction page[64];
+    uint32_t blocks[64];
+    size_t rounds = 2000;
+    size_t ops = 0;
+    double t0 = bench_now();
+    uint64_t c0 = bench_cycles();
+    for (size_t r = 0; r < rounds; ++r) {
+        ops += eltt_blockchain_wallet_activity(bc, "wallet-0", 0, 64,
+                                               page, blocks);
+    }
+    uint64_t c1 = bench_cycles();
+    double t1 = bench_now();
+    bench_report("wallet_activity", ops, t1 - t0, c1 - c0);
+}
+
+static void bench_energy(const eltt_blockchain *bc, size_t total_txs)
+{
+    eltt_blockchain_energy_cache_reset();
+    double t0 = bench_now();
+    uint64_t c0 = bench_cycles();
+    size_t visited = eltt_blockchain_prewarm_energy_cache(bc, 0,
+                                                          bc->block_count - 1);
+    uint64_t c1 = bench_cycles();
+    double t1 = bench_now();
+    bench_report("energy_cold", visited, t1 - t0, c1 - c0);
+
+    t0 = bench_now();
+    c0 = bench_cycles();
+    visited = eltt_blockchain_prewarm_energy_cache(bc, 0, bc->block_count - 1);
+    c1 = bench_cycles();
+    t1 = bench_now();
+    bench_report("energy_warm", visited, t1 - t0, c1 - c0);
+    (void)total_txs;
+}
+
+/* ----------------------------------------------------------
+ * main
+ * ---------------------------------------------------------- */
+
+int main(int argc, char **argv)
+{
+    eltt_workload_params p;
+    p.block_count = 500;
+    p.txs_per_block = 128;
+    p.wallet_cardinality = 512;
+    p.address_reuse_ratio = 0.8;
+    p.seed = 42;
+    if (argc > 1) p.block_count = (size_t)strtoull(argv[1], NULL, 10);
+    if (argc > 2) p.txs_per_block = (size_t)strtoull(argv[2], NULL, 10);
+    if (argc > 3) p.wallet_cardinality = (size_t)strtoull(argv[3], NULL, 10);
+    if (argc > 4) p.address_reuse_ratio = strtod(argv[4], NULL);
+    if (argc > 5) p.seed = strtoull(argv[5], NULL, 10);
+
+    fprintf(stderr,
+            "eltt-bench: blocks=%zu txs/block=%zu wallets=%zu reuse=%.2f "
+            "seed=%llu sha-backend=%s\n",
+            p.block_count, p.txs_per_block, p.wallet_cardinality,
+            p.address_reuse_ratio, (unsigned long long)p.seed,
+            eltt_sha256_backend_name());
+
+    eltt_blockchain *bc = malloc(sizeof(*bc));
+    if (!bc) {
+        fprintf(stderr, "eltt-bench: out of memory\n");
+        return 1;
+    }
+
+    size_t total_txs = bench_append(&p, bc);
+    bench_sha256(&p);
+    bench_validator(bc);
+    bench_viewer_grid(bc);
+    bench_activity(bc);
+    bench_energy(bc, total_txs);
+
+    eltt_blockchain_free(bc);
+    free(bc);
+    return 0;
+}
+
+/* Ende: Root/ELTT-Bench.c */
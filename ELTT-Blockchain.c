@@ -20,9 +20,100 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ELTT_SHA256_X86_BACKENDS 1
+#include <immintrin.h>
+#endif
+
+/* ----------------------------------------------------------
+ * Instrumentierung
+ *
+ * Zähler und Latenz-Histogramme für die heißen Pfade, billig genug
+ * für den Dauerbetrieb: reine relaxed-Atomics, keine Locks, kein
+ * Compile-Schalter. Die Histogramme sind Zweierpotenz-Buckets über
+ * Nanosekunden (Bucket k zählt Laufzeiten in [2^k, 2^(k+1))).
+ * Gelesen wird über eltt_stats_snapshot() (konsistenzfrei, aber
+ * monoton); der Launcher exportiert den Snapshot als JSON.
+ * ---------------------------------------------------------- */
+
+#include <stdatomic.h>
+#include <time.h>
+
+#define ELTT_STATS_HIST_BUCKETS 16
+
+typedef struct {
+    atomic_uint_fast64_t blocks_appended;
+    atomic_uint_fast64_t blocks_rejected;
+    atomic_uint_fast64_t txs_applied;
+    atomic_uint_fast64_t block_validations;
+    atomic_uint_fast64_t wallet_lookups;
+    atomic_uint_fast64_t wallets_created;
+    atomic_uint_fast64_t sha256_messages;
+    atomic_uint_fast64_t sha256_batches;
+    atomic_uint_fast64_t energy_cache_hits;
+    atomic_uint_fast64_t energy_cache_misses;
+    atomic_uint_fast64_t activity_grows;
+    atomic_uint_fast64_t viewer_builds;
+    atomic_uint_fast64_t append_ns_hist[ELTT_STATS_HIST_BUCKETS];
+    atomic_uint_fast64_t validate_ns_hist[ELTT_STATS_HIST_BUCKETS];
+} eltt_stats;
+
+/* Plain-Abbild der Zähler für Leser (siehe eltt_stats_snapshot). */
+typedef struct {
+    uint64_t blocks_appended;
+    uint64_t blocks_rejected;
+    uint64_t txs_applied;
+    uint64_t block_validations;
+    uint64_t wallet_lookups;
+    uint64_t wallets_created;
+    uint64_t sha256_messages;
+    uint64_t sha256_batches;
+    uint64_t energy_cache_hits;
+    uint64_t energy_cache_misses;
+    uint64_t activity_grows;
+    uint64_t viewer_builds;
+    uint64_t append_ns_hist[ELTT_STATS_HIST_BUCKETS];
+    uint64_t validate_ns_hist[ELTT_STATS_HIST_BUCKETS];
+} eltt_stats_view;
+
+static eltt_stats eltt_stats_state;
+
+static inline void eltt_stats_add(atomic_uint_fast64_t *c, uint64_t n)
+{
+    atomic_fetch_add_explicit(c, n, memory_order_relaxed);
+}
+
+static uint64_t eltt_stats_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void eltt_stats_hist_record(atomic_uint_fast64_t *hist, uint64_t ns)
+{
+    unsigned bucket = 0;
+    while (ns > 1 && bucket < ELTT_STATS_HIST_BUCKETS - 1) {
+        ns >>= 1;
+        bucket++;
+    }
+    eltt_stats_add(&hist[bucket], 1);
+}
 
 /* ----------------------------------------------------------
  * SHA-256 – deterministische Implementierung
+ *
+ * Das Ergebnis ist für alle Backends bitidentisch; zur Laufzeit wird
+ * per CPU-Erkennung das schnellste verfügbare Backend gewählt:
+ *   - SHA-NI (x86-Erweiterung, ein Block pro Aufruf)
+ *   - AVX2 (8 unabhängige Nachrichten parallel, nur Batch-Pfad)
+ *   - skalarer Fallback (portabel, Referenz)
  * ---------------------------------------------------------- */
 
 typedef struct {
@@ -51,7 +142,7 @@ static const uint32_t eltt_sha256_k[64] = {
     0x748f82eeUL,0x78a5636fUL,0x84c87814UL,0x8cc70208UL,0x90befffaUL,0xa4506cebUL,0xbef9a3f7UL,0xc67178f2UL
 };
 
-static void eltt_sha256_transform(eltt_sha256_ctx *ctx, const uint8_t data[])
+static void eltt_sha256_transform_scalar(eltt_sha256_ctx *ctx, const uint8_t data[])
 {
     uint32_t a,b,c,d,e,f,g,h,i,j,t1,t2,m[64];
 
@@ -97,6 +188,238 @@ static void eltt_sha256_transform(eltt_sha256_ctx *ctx, const uint8_t data[])
     ctx->state[7] += h;
 }
 
+#ifdef ELTT_SHA256_X86_BACKENDS
+
+/* SHA-NI-Backend: verarbeitet einen 64-Byte-Block über die
+ * SHA-Erweiterungen. Bitidentisch zum skalaren Backend. */
+__attribute__((target("sha,sse4.1")))
+static void eltt_sha256_transform_shani(eltt_sha256_ctx *ctx, const uint8_t data[])
+{
+    __m128i state0, state1, msg, tmp;
+    __m128i msg0, msg1, msg2, msg3;
+    __m128i abef_save, cdgh_save;
+    const __m128i shuf_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    tmp    = _mm_loadu_si128((const __m128i *)&ctx->state[0]);
+    state1 = _mm_loadu_si128((const __m128i *)&ctx->state[4]);
+
+    tmp    = _mm_shuffle_epi32(tmp, 0xB1);
+    state1 = _mm_shuffle_epi32(state1, 0x1B);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    abef_save = state0;
+    cdgh_save = state1;
+
+    /* Runden 0-3 */
+    msg0 = _mm_loadu_si128((const __m128i *)(data + 0));
+    msg0 = _mm_shuffle_epi8(msg0, shuf_mask);
+    msg = _mm_add_epi32(msg0, _mm_set_epi64x(0xE9B5DBA5B5C0FBCFULL, 0x71374491428A2F98ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+    /* Runden 4-7 */
+    msg1 = _mm_loadu_si128((const __m128i *)(data + 16));
+    msg1 = _mm_shuffle_epi8(msg1, shuf_mask);
+    msg = _mm_add_epi32(msg1, _mm_set_epi64x(0xAB1C5ED5923F82A4ULL, 0x59F111F13956C25BULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+    /* Runden 8-11 */
+    msg2 = _mm_loadu_si128((const __m128i *)(data + 32));
+    msg2 = _mm_shuffle_epi8(msg2, shuf_mask);
+    msg = _mm_add_epi32(msg2, _mm_set_epi64x(0x550C7DC3243185BEULL, 0x12835B01D807AA98ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+    /* Runden 12-15 */
+    msg3 = _mm_loadu_si128((const __m128i *)(data + 48));
+    msg3 = _mm_shuffle_epi8(msg3, shuf_mask);
+    msg = _mm_add_epi32(msg3, _mm_set_epi64x(0xC19BF1749BDC06A7ULL, 0x80DEB1FE72BE5D74ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg3, msg2, 4);
+    msg0 = _mm_add_epi32(msg0, tmp);
+    msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+    /* Runden 16-19 */
+    msg = _mm_add_epi32(msg0, _mm_set_epi64x(0x240CA1CC0FC19DC6ULL, 0xEFBE4786E49B69C1ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg0, msg3, 4);
+    msg1 = _mm_add_epi32(msg1, tmp);
+    msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+    /* Runden 20-23 */
+    msg = _mm_add_epi32(msg1, _mm_set_epi64x(0x76F988DA5CB0A9DCULL, 0x4A7484AA2DE92C6FULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg1, msg0, 4);
+    msg2 = _mm_add_epi32(msg2, tmp);
+    msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+    /* Runden 24-27 */
+    msg = _mm_add_epi32(msg2, _mm_set_epi64x(0xBF597FC7B00327C8ULL, 0xA831C66D983E5152ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg2, msg1, 4);
+    msg3 = _mm_add_epi32(msg3, tmp);
+    msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+    /* Runden 28-31 */
+    msg = _mm_add_epi32(msg3, _mm_set_epi64x(0x1429296706CA6351ULL, 0xD5A79147C6E00BF3ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg3, msg2, 4);
+    msg0 = _mm_add_epi32(msg0, tmp);
+    msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+    /* Runden 32-35 */
+    msg = _mm_add_epi32(msg0, _mm_set_epi64x(0x53380D134D2C6DFCULL, 0x2E1B213827B70A85ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg0, msg3, 4);
+    msg1 = _mm_add_epi32(msg1, tmp);
+    msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+    /* Runden 36-39 */
+    msg = _mm_add_epi32(msg1, _mm_set_epi64x(0x92722C8581C2C92EULL, 0x766A0ABB650A7354ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg1, msg0, 4);
+    msg2 = _mm_add_epi32(msg2, tmp);
+    msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+    /* Runden 40-43 */
+    msg = _mm_add_epi32(msg2, _mm_set_epi64x(0xC76C51A3C24B8B70ULL, 0xA81A664BA2BFE8A1ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg2, msg1, 4);
+    msg3 = _mm_add_epi32(msg3, tmp);
+    msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+    /* Runden 44-47 */
+    msg = _mm_add_epi32(msg3, _mm_set_epi64x(0x106AA070F40E3585ULL, 0xD6990624D192E819ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg3, msg2, 4);
+    msg0 = _mm_add_epi32(msg0, tmp);
+    msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+    /* Runden 48-51 */
+    msg = _mm_add_epi32(msg0, _mm_set_epi64x(0x34B0BCB52748774CULL, 0x1E376C0819A4C116ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg0, msg3, 4);
+    msg1 = _mm_add_epi32(msg1, tmp);
+    msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+    /* Runden 52-55 */
+    msg = _mm_add_epi32(msg1, _mm_set_epi64x(0x682E6FF35B9CCA4FULL, 0x4ED8AA4A391C0CB3ULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg1, msg0, 4);
+    msg2 = _mm_add_epi32(msg2, tmp);
+    msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+    /* Runden 56-59 */
+    msg = _mm_add_epi32(msg2, _mm_set_epi64x(0x8CC7020884C87814ULL, 0x78A5636F748F82EEULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    tmp = _mm_alignr_epi8(msg2, msg1, 4);
+    msg3 = _mm_add_epi32(msg3, tmp);
+    msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+    /* Runden 60-63 */
+    msg = _mm_add_epi32(msg3, _mm_set_epi64x(0xC67178F2BEF9A3F7ULL, 0xA4506CEB90BEFFFAULL));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+    state0 = _mm_add_epi32(state0, abef_save);
+    state1 = _mm_add_epi32(state1, cdgh_save);
+
+    tmp    = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+    _mm_storeu_si128((__m128i *)&ctx->state[0], state0);
+    _mm_storeu_si128((__m128i *)&ctx->state[4], state1);
+}
+
+#endif /* ELTT_SHA256_X86_BACKENDS */
+
+/* ----------------------------------------------------------
+ * Backend-Auswahl zur Laufzeit
+ * ---------------------------------------------------------- */
+
+typedef void (*eltt_sha256_transform_fn)(eltt_sha256_ctx *, const uint8_t *);
+
+typedef enum {
+    ELTT_SHA256_BACKEND_UNSET = 0,
+    ELTT_SHA256_BACKEND_SCALAR,
+    ELTT_SHA256_BACKEND_SHANI,
+    ELTT_SHA256_BACKEND_AVX2
+} eltt_sha256_backend_kind;
+
+static eltt_sha256_transform_fn eltt_sha256_transform_impl = NULL;
+static eltt_sha256_backend_kind eltt_sha256_backend_selected = ELTT_SHA256_BACKEND_UNSET;
+
+static void eltt_sha256_select_backend(void)
+{
+#ifdef ELTT_SHA256_X86_BACKENDS
+    if (__builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1")) {
+        eltt_sha256_transform_impl = eltt_sha256_transform_shani;
+        eltt_sha256_backend_selected = ELTT_SHA256_BACKEND_SHANI;
+        return;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        /* Einzel-Nachrichten laufen skalar, der Batch-Pfad 8-fach parallel. */
+        eltt_sha256_transform_impl = eltt_sha256_transform_scalar;
+        eltt_sha256_backend_selected = ELTT_SHA256_BACKEND_AVX2;
+        return;
+    }
+#endif
+    eltt_sha256_transform_impl = eltt_sha256_transform_scalar;
+    eltt_sha256_backend_selected = ELTT_SHA256_BACKEND_SCALAR;
+}
+
+static void eltt_sha256_transform(eltt_sha256_ctx *ctx, const uint8_t data[])
+{
+    if (!eltt_sha256_transform_impl) {
+        eltt_sha256_select_backend();
+    }
+    eltt_sha256_transform_impl(ctx, data);
+}
+
 static void eltt_sha256_init(eltt_sha256_ctx *ctx)
 {
     ctx->datalen = 0;
@@ -126,6 +449,10 @@ static void eltt_sha256_update(eltt_sha256_ctx *ctx, const uint8_t data[], size_
 
 static void eltt_sha256_final(eltt_sha256_ctx *ctx, uint8_t hash[])
 {
+    /* Jede fertiggestellte Nachricht läuft hier durch (auch die
+     * Streaming-Pfade); nur der AVX2-Batch zählt selbst. */
+    eltt_stats_add(&eltt_stats_state.sha256_messages, 1);
+
     uint32_t i = ctx->datalen;
 
     if (ctx->datalen < 56) {
@@ -173,6 +500,213 @@ static void eltt_sha256(const uint8_t *data, size_t len, uint8_t out[32])
     eltt_sha256_final(&ctx, out);
 }
 
+/* ----------------------------------------------------------
+ * Mehrkanal-Batch-Hashing (mehrere unabhängige Nachrichten pro Aufruf)
+ * ---------------------------------------------------------- */
+
+/* Anzahl der 64-Byte-Blöcke einer Nachricht inklusive Padding. */
+static size_t eltt_sha256_padded_blocks(size_t len)
+{
+    return (len + 8) / 64 + 1;
+}
+
+/* Schreibt den Block block_idx einer Nachricht (inklusive 0x80-Markierung
+ * und Bit-Länge im letzten Block) nach out[64]. */
+static void eltt_sha256_fill_block(const uint8_t *msg, size_t len,
+                                   size_t block_idx, size_t total_blocks,
+                                   uint8_t out[64])
+{
+    size_t off = block_idx * 64;
+    uint64_t bitlen = (uint64_t)len * 8;
+
+    if (off + 64 <= len) {
+        memcpy(out, msg + off, 64);
+        return;
+    }
+
+    memset(out, 0, 64);
+    if (off < len) {
+        memcpy(out, msg + off, len - off);
+    }
+    if (off <= len && len < off + 64) {
+        out[len - off] = 0x80;
+    }
+    if (block_idx == total_blocks - 1) {
+        for (int i = 0; i < 8; ++i) {
+            out[63 - i] = (uint8_t)(bitlen >> (8 * i));
+        }
+    }
+}
+
+#ifdef ELTT_SHA256_X86_BACKENDS
+
+#define ELTT_AVX2_ROTR(x, r) \
+    _mm256_or_si256(_mm256_srli_epi32((x), (r)), _mm256_slli_epi32((x), 32 - (r)))
+
+/* AVX2-Backend: hasht bis zu 8 unabhängige Nachrichten gleichzeitig,
+ * eine Lane pro Nachricht. Lanes, deren Nachricht endet, werden beim
+ * letzten Block ausgeleitet; kürzere Lanes verarbeiten danach
+ * Dummy-Blöcke, deren Ergebnis verworfen wird. */
+__attribute__((target("avx2")))
+static void eltt_sha256_x8_avx2(const uint8_t *const *msgs, const size_t *lens,
+                                size_t lanes, uint8_t (*out)[32])
+{
+    __m256i s[8];
+    size_t blocks[8];
+    size_t max_blocks = 0;
+    uint8_t blockbuf[8][64];
+    uint32_t w_words[16][8];
+
+    static const uint32_t iv[8] = {
+        0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
+        0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL
+    };
+
+    for (size_t l = 0; l < 8; ++l) {
+        size_t src = (l < lanes) ? l : 0;
+        blocks[l] = eltt_sha256_padded_blocks(lens[src]);
+        if (l < lanes && blocks[l] > max_blocks) {
+            max_blocks = blocks[l];
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        s[i] = _mm256_set1_epi32((int)iv[i]);
+    }
+
+    for (size_t blk = 0; blk < max_blocks; ++blk) {
+        for (size_t l = 0; l < 8; ++l) {
+            size_t src = (l < lanes) ? l : 0;
+            size_t bi = (blk < blocks[l]) ? blk : blocks[l] - 1;
+            eltt_sha256_fill_block(msgs[src], lens[src], bi, blocks[l], blockbuf[l]);
+        }
+
+        for (int t = 0; t < 16; ++t) {
+            for (int l = 0; l < 8; ++l) {
+                uint32_t v;
+                memcpy(&v, blockbuf[l] + 4 * t, 4);
+                w_words[t][l] = __builtin_bswap32(v);
+            }
+        }
+
+        __m256i w[16];
+        for (int t = 0; t < 16; ++t) {
+            w[t] = _mm256_loadu_si256((const __m256i *)w_words[t]);
+        }
+
+        __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+        __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+
+        for (int t = 0; t < 64; ++t) {
+            __m256i wt;
+            if (t < 16) {
+                wt = w[t];
+            } else {
+                __m256i w2  = w[(t - 2) & 15];
+                __m256i w15 = w[(t - 15) & 15];
+                __m256i sig1 = _mm256_xor_si256(
+                    _mm256_xor_si256(ELTT_AVX2_ROTR(w2, 17), ELTT_AVX2_ROTR(w2, 19)),
+                    _mm256_srli_epi32(w2, 10));
+                __m256i sig0 = _mm256_xor_si256(
+                    _mm256_xor_si256(ELTT_AVX2_ROTR(w15, 7), ELTT_AVX2_ROTR(w15, 18)),
+                    _mm256_srli_epi32(w15, 3));
+                wt = _mm256_add_epi32(_mm256_add_epi32(sig1, w[(t - 7) & 15]),
+                                      _mm256_add_epi32(sig0, w[(t - 16) & 15]));
+                w[t & 15] = wt;
+            }
+
+            __m256i ep1 = _mm256_xor_si256(
+                _mm256_xor_si256(ELTT_AVX2_ROTR(e, 6), ELTT_AVX2_ROTR(e, 11)),
+                ELTT_AVX2_ROTR(e, 25));
+            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f),
+                                          _mm256_andnot_si256(e, g));
+            __m256i t1 = _mm256_add_epi32(
+                _mm256_add_epi32(_mm256_add_epi32(h, ep1), _mm256_add_epi32(ch, wt)),
+                _mm256_set1_epi32((int)eltt_sha256_k[t]));
+            __m256i ep0 = _mm256_xor_si256(
+                _mm256_xor_si256(ELTT_AVX2_ROTR(a, 2), ELTT_AVX2_ROTR(a, 13)),
+                ELTT_AVX2_ROTR(a, 22));
+            __m256i maj = _mm256_xor_si256(
+                _mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(a, c)),
+                _mm256_and_si256(b, c));
+            __m256i t2 = _mm256_add_epi32(ep0, maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = _mm256_add_epi32(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = _mm256_add_epi32(t1, t2);
+        }
+
+        s[0] = _mm256_add_epi32(s[0], a);
+        s[1] = _mm256_add_epi32(s[1], b);
+        s[2] = _mm256_add_epi32(s[2], c);
+        s[3] = _mm256_add_epi32(s[3], d);
+        s[4] = _mm256_add_epi32(s[4], e);
+        s[5] = _mm256_add_epi32(s[5], f);
+        s[6] = _mm256_add_epi32(s[6], g);
+        s[7] = _mm256_add_epi32(s[7], h);
+
+        int any_done = 0;
+        for (size_t l = 0; l < lanes; ++l) {
+            if (blocks[l] == blk + 1) {
+                any_done = 1;
+            }
+        }
+        if (any_done) {
+            uint32_t st[8][8];
+            for (int i = 0; i < 8; ++i) {
+                _mm256_storeu_si256((__m256i *)st[i], s[i]);
+            }
+            for (size_t l = 0; l < lanes; ++l) {
+                if (blocks[l] != blk + 1) {
+                    continue;
+                }
+                for (int i = 0; i < 8; ++i) {
+                    uint32_t v = st[i][l];
+                    out[l][4 * i + 0] = (uint8_t)(v >> 24);
+                    out[l][4 * i + 1] = (uint8_t)(v >> 16);
+                    out[l][4 * i + 2] = (uint8_t)(v >> 8);
+                    out[l][4 * i + 3] = (uint8_t)(v);
+                }
+            }
+        }
+    }
+}
+
+#endif /* ELTT_SHA256_X86_BACKENDS */
+
+static void eltt_sha256_batch(const uint8_t **msgs, const size_t *lens,
+                              size_t n, uint8_t (*out)[32])
+{
+    if (!eltt_sha256_transform_impl) {
+        eltt_sha256_select_backend();
+    }
+    eltt_stats_add(&eltt_stats_state.sha256_batches, 1);
+
+#ifdef ELTT_SHA256_X86_BACKENDS
+    if (eltt_sha256_backend_selected == ELTT_SHA256_BACKEND_AVX2 && n >= 2) {
+        size_t i = 0;
+        while (i < n) {
+            size_t lanes = (n - i < 8) ? (n - i) : 8;
+            eltt_sha256_x8_avx2(&msgs[i], &lens[i], lanes, &out[i]);
+            i += lanes;
+        }
+        eltt_stats_add(&eltt_stats_state.sha256_messages, n);
+        return;
+    }
+#endif
+
+    /* SHA-NI bzw. skalarer Fallback: Nachrichten einzeln durch das
+     * dispatchte Transform. */
+    for (size_t i = 0; i < n; ++i) {
+        eltt_sha256(msgs[i], lens[i], out[i]);
+    }
+}
+
 /* ----------------------------------------------------------
  * Byte-Systeme (SI und binär) – normative Tabellen
  * ---------------------------------------------------------- */
@@ -246,18 +780,38 @@ static const eltt_binary_byte_unit ELTT_BINARY_BYTE_TABLE[24] = {
 
 /* Normative Hilfsfunktionen zur Energie-Berechnung */
 
+/* Index der größten Einheit, deren Schwellwert <= b ist. Die Tabellen
+ * sind aufsteigend sortiert; die Auswahl ist damit die Summe der
+ * Schwellwert-Vergleiche — verzweigungsfrei und ohne Divisionen (die
+ * alte Variante teilte b durch alle 24 Einträge und verwarf die
+ * Ergebnisse). */
+static int eltt_si_byte_unit_index(double b)
+{
+    int idx = 0;
+    for (int i = 1; i < 24; ++i) {
+        idx += (ELTT_SI_BYTE_TABLE[i].power10 <= b);
+    }
+    return idx;
+}
+
+static int eltt_binary_byte_unit_index(double b)
+{
+    int idx = 0;
+    for (int i = 1; i < 24; ++i) {
+        idx += (ELTT_BINARY_BYTE_TABLE[i].approx_bytes <= b);
+    }
+    return idx;
+}
+
+/* Die Wertfunktionen sind normativ die Identität auf der Byte-Größe;
+ * die Einheiten-Tabellen dienen der Benennung (siehe die
+ * *_unit_symbol-Accessoren am Dateiende). */
 static double eltt_si_byte_value_from_size(size_t bytes)
 {
     if (bytes == 0) {
         return 0.0;
     }
-    double b = (double)bytes;
-    double best = b;
-    for (int i = 0; i < 24; ++i) {
-        double v = b / ELTT_SI_BYTE_TABLE[i].power10;
-        (void)v;
-    }
-    return b;
+    return (double)bytes;
 }
 
 static double eltt_binary_byte_value_from_size(size_t bytes)
@@ -265,13 +819,7 @@ static double eltt_binary_byte_value_from_size(size_t bytes)
     if (bytes == 0) {
         return 0.0;
     }
-    double b = (double)bytes;
-    double best = b;
-    for (int i = 0; i < 24; ++i) {
-        double v = b / ELTT_BINARY_BYTE_TABLE[i].approx_bytes;
-        (void)v;
-    }
-    return b;
+    return (double)bytes;
 }
 
 /* ----------------------------------------------------------
@@ -288,6 +836,84 @@ static double eltt_binary_byte_value_from_size(size_t bytes)
 #define ELTT_MAX_POOLS            256
 #define ELTT_MAX_STAKES           1024
 
+/* Staking-Accrual: lineare Rate (APR) pro gestaketem Token, zeitbasiert
+ * über die Block-Zeitstempel. Entspricht dem Schätzer in
+ * ELTT-Staking.py, hier aber exakt und O(1) je Position. */
+#define ELTT_STAKE_APR              0.05
+#define ELTT_STAKE_SECONDS_PER_YEAR 31536000.0
+
+/* Kapazität des Adress-Index (offene Adressierung, Zweierpotenz,
+ * mindestens 2 * ELTT_MAX_WALLETS, damit die Last unter 50 % bleibt). */
+#define ELTT_WALLET_INDEX_CAP     2048
+
+/* Adress-Interning: jede im Prozess gesehene Adresse bekommt beim
+ * ersten Auftreten eine dichte 32-Bit-ID (1-basiert, 0 = nicht
+ * interniert). Heiße Schleifen vergleichen danach Ganzzahlen statt
+ * 64-Byte-Strings; die String-Form bleibt für Serialisierung und
+ * Hashing über die Tabelle erreichbar. */
+#define ELTT_INTERN_MAX_IDS       16384
+#define ELTT_INTERN_MAP_CAP       32768
+
+/* Festkomma-Guthaben: int64, skaliert mit 10^8 (alle Token entstehen
+ * mit decimals = 8, siehe eltt_init_blockchain). Ganzzahl-Arithmetik
+ * macht die Validator-Vergleiche exakt statt epsilon-basiert, lässt
+ * die Guthaben-Scans ohne strikte FP-Regeln vektorisieren und ersetzt
+ * stille Rundungsdrift durch sättigende, geprüfte Addition.
+ * Transaktionsbeträge bleiben im Wire-Format double (Hash-Stabilität)
+ * und werden an der Grenze einmal umgerechnet. */
+typedef int64_t eltt_amount_fp;
+#define ELTT_FP_SCALE 100000000LL
+
+/* Sättigende Umrechnung double -> Festkomma (kaufmännisch gerundet). */
+static eltt_amount_fp eltt_fp_from_double(double x)
+{
+    double scaled = x * (double)ELTT_FP_SCALE;
+    if (scaled >= 9223372036854775807.0) {
+        return INT64_MAX;
+    }
+    if (scaled <= -9223372036854775807.0) {
+        return INT64_MIN;
+    }
+    return (eltt_amount_fp)llround(scaled);
+}
+
+static double eltt_fp_to_double(eltt_amount_fp v)
+{
+    return (double)v / (double)ELTT_FP_SCALE;
+}
+
+/* Sättigende Addition: klemmt an INT64_MIN/MAX statt überzulaufen. */
+static eltt_amount_fp eltt_fp_add_sat(eltt_amount_fp a, eltt_amount_fp b)
+{
+    if (b > 0 && a > INT64_MAX - b) {
+        return INT64_MAX;
+    }
+    if (b < 0 && a < INT64_MIN - b) {
+        return INT64_MIN;
+    }
+    return a + b;
+}
+
+/* Segmentierter Block-Speicher: Blöcke liegen in fest großen Chunks,
+ * die einmal alloziert und nie verschoben werden. Block-Zeiger bleiben
+ * dadurch über die gesamte Lebensdauer der Chain stabil. */
+#define ELTT_BLOCKS_PER_CHUNK     64
+#define ELTT_MAX_BLOCK_CHUNKS     8192
+
+/* Größe des Adress-Bloom-Filters je Block (Bits = Bytes * 8). 32 Byte
+ * genügen, um bei historischen Scans nach unbekannten Adressen die
+ * große Mehrheit der Blöcke ohne Blick in ihre Transaktions-Arrays zu
+ * überspringen; Fehltreffer kosten nur einen regulären Block-Scan. */
+#define ELTT_BLOOM_BYTES          32
+
+/* Transaktions-Arena: Transaktionen liegen nicht mehr im Block selbst,
+ * sondern in gemeinsamen, fest großen Chunks. Die Transaktionen eines
+ * Blocks sind immer zusammenhängend innerhalb eines Chunks, die Zeiger
+ * bleiben stabil. Speicher wächst mit dem tatsächlichen
+ * Transaktionsvolumen statt mit ELTT_MAX_TX_PER_BLOCK pro Block. */
+#define ELTT_TX_CHUNK_CAP         4096
+#define ELTT_MAX_TX_CHUNKS        4096
+
 typedef enum {
     ELTT_TOKEN_KIND_TTTC,
     ELTT_TOKEN_KIND_ELTT,
@@ -304,11 +930,12 @@ typedef struct {
     double energy_binding_factor;
 } eltt_token_type;
 
+/* Wallets tragen nur noch ihre Adresse: die kanonischen Token-
+ * Beschreibungen stehen ausschließlich in der gemeinsamen Registry
+ * (bc->token_types), die Guthaben liegen token-major in
+ * bc->wallet_balances (Struct-of-Arrays, siehe dort). */
 typedef struct {
     char  address[ELTT_MAX_ADDRESS_LEN];
-    size_t token_count;
-    eltt_token_type tokens[ELTT_MAX_TOKEN_TYPES];
-    double balances[ELTT_MAX_TOKEN_TYPES];
 } eltt_wallet;
 
 typedef enum {
@@ -334,6 +961,12 @@ typedef struct {
     int   token_index;
     eltt_tx_kind kind;
     char  memo[ELTT_MAX_MEMO_LEN];
+    /* Interning-Cache: IDs der from/to-Adressen, 0 = noch nicht
+     * interniert. Nur prozess-lokal gültig, nicht Teil des
+     * Wire-Formats (Serialisierung und Hashing laufen über die
+     * Strings); beim Laden von Platte werden sie neu vergeben. */
+    uint32_t from_id;
+    uint32_t to_id;
 } eltt_transaction;
 
 typedef struct {
@@ -341,8 +974,12 @@ typedef struct {
     uint64_t timestamp;
     uint8_t  prev_hash[32];
     uint8_t  hash[32];
+    /* Merkle-Wurzel über die serialisierten Transaktionen des Blocks */
+    uint8_t  merkle_root[32];
     size_t   tx_count;
-    eltt_transaction txs[ELTT_MAX_TX_PER_BLOCK];
+    /* Zeigt für gespeicherte Blöcke in die Transaktions-Arena der
+     * Blockchain; bei Kandidaten-Blöcken auf das Array des Aufrufers. */
+    eltt_transaction *txs;
 } eltt_block;
 
 typedef struct {
@@ -360,175 +997,774 @@ typedef struct {
     uint64_t start_timestamp;
     uint64_t lock_until;
     double accumulated_rewards;
+    /* Stand des globalen Reward-per-Token-Akkumulators beim letzten
+     * Berühren der Position (Stake/Unstake/Claim). Ausstehende Rewards
+     * sind amount * (Akkumulator - Snapshot) — O(1) je Position. */
+    double reward_per_token_snap;
 } eltt_staking_position;
 
+/* Teilzustände mit eigenem Generationszähler: der Apply-Pfad erhöht
+ * nur den Zähler des tatsächlich berührten Teils, Viewer können damit
+ * unveränderte Ansichten komplett überspringen. */
+typedef enum {
+    ELTT_VIEW_CHAIN = 0,
+    ELTT_VIEW_WALLETS,
+    ELTT_VIEW_POOLS,
+    ELTT_VIEW_STAKES,
+    ELTT_VIEW_COUNT
+} eltt_view_kind;
+
+/* Materialisierte Pool-Ansicht (muss mit ELTT-Viewer.c übereinstimmen). */
+typedef struct {
+    int pool_index;
+    int token_x_index;
+    int token_y_index;
+    double reserve_x;
+    double reserve_y;
+    int lp_token_index;
+} eltt_pool_view_entry;
+
+/* Posting-Liste für Wallet-Aktivität: je Wallet eine wachsende Liste
+ * von (Block-Index, Transaktions-Index)-Paaren, gepflegt beim Anhängen
+ * von Blöcken. Aktivitätsabfragen laufen damit nur über die Einträge
+ * der einen Wallet statt über alle Transaktionen der Chain. */
+typedef struct {
+    uint32_t block_index;
+    uint32_t tx_index;
+} eltt_tx_ref;
+
+typedef struct {
+    size_t count;
+    size_t cap;
+    eltt_tx_ref *refs;   /* Heap, wächst geometrisch */
+} eltt_activity_list;
+
 typedef struct {
     size_t block_count;
-    eltt_block *blocks;
+    /* Chunk-Verzeichnis des segmentierten Block-Speichers; Eintrag i
+     * zeigt auf ein Array von ELTT_BLOCKS_PER_CHUNK Blöcken oder NULL. */
+    eltt_block *block_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    /* Adress-Bloom-Filter je Block, segmentiert wie die Blöcke selbst:
+     * Chunk i trägt ELTT_BLOCKS_PER_CHUNK Filter à ELTT_BLOOM_BYTES. */
+    uint8_t *bloom_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    /* Transaktions-Arena (siehe ELTT_TX_CHUNK_CAP) */
+    size_t tx_chunk_count;
+    size_t tx_chunk_used;
+    eltt_transaction *tx_chunks[ELTT_MAX_TX_CHUNKS];
     size_t wallet_count;
     eltt_wallet wallets[ELTT_MAX_WALLETS];
+    /* Wallet-Guthaben in Struct-of-Arrays-Anordnung: Zeile t enthält
+     * die Guthaben aller Wallets für Token t (Festkomma, siehe
+     * eltt_amount_fp). Scans über ein Token (Validator, Batch-
+     * Anwendung) laufen dadurch über zusammenhängende Ganzzahlen
+     * statt über 6-KB-Wallet-Strukturen. */
+    eltt_amount_fp wallet_balances[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_WALLETS];
     size_t token_count;
     eltt_token_type token_types[ELTT_MAX_TOKEN_TYPES];
     size_t pool_count;
     eltt_liquidity_pool pools[ELTT_MAX_POOLS];
     size_t stake_count;
     eltt_staking_position stakes[ELTT_MAX_STAKES];
+    /* Globaler Reward-per-Token-Akkumulator je Token-Index und der
+     * Zeitstempel des letzten Accrual-Blocks. Wird einmal pro Block
+     * fortgeschrieben; Positionen verrechnen dagegen ihren Snapshot. */
+    double   stake_reward_per_token[ELTT_MAX_TOKEN_TYPES];
+    uint64_t stake_accrual_timestamp;
+    /* Adress-Index: Hash-Tabelle (offene Adressierung) von Adresse auf
+     * Wallet-Index. -1 bedeutet leerer Slot. Wird in eltt_add_wallet()
+     * gepflegt, Lookups sind dadurch O(1) statt O(wallet_count). */
+    int32_t wallet_index_map[ELTT_WALLET_INDEX_CAP];
+    /* Direkt-Map von Intern-ID auf Wallet-Index (-1 = keine Wallet).
+     * Wallet-Lookups über eine ID sind damit ein einzelner
+     * Array-Zugriff ohne Hashing und ohne strcmp. */
+    int32_t id_to_wallet[ELTT_INTERN_MAX_IDS + 1];
+    /* Generationszähler je Teilzustand (siehe eltt_view_kind) und
+     * materialisierte Pool-Ansicht; beides wird inkrementell aus dem
+     * Apply-Pfad gepflegt, nicht bei jeder Abfrage neu aufgebaut. */
+    uint64_t view_generations[ELTT_VIEW_COUNT];
+    size_t pool_view_count;
+    eltt_pool_view_entry pool_view[ELTT_MAX_POOLS];
+    /* Aktivitäts-Index: Eintrag i ist die Posting-Liste der Wallet i. */
+    eltt_activity_list activity[ELTT_MAX_WALLETS];
 } eltt_blockchain;
 
 /* ----------------------------------------------------------
  * Hilfsfunktionen für Hashing und Serialisierung
  * ---------------------------------------------------------- */
 
-static void eltt_serialize_transaction(const eltt_transaction *tx, uint8_t **out, size_t *out_len)
+/* Caller-gestellte Scratch-Arena: serialisiert wird in einen vom
+ * Aufrufer bereitgestellten Puffer (typisch auf dem Stack), nicht in
+ * frisch allozierten Heap-Speicher. Ein reset() macht den Puffer für
+ * die nächste Transaktion wiederverwendbar. */
+typedef struct {
+    uint8_t *buf;
+    size_t   cap;
+    size_t   used;
+} eltt_arena;
+
+/* Obergrenze des Serialisierungsformats einer Transaktion
+ * (from + to + amount + token_index + kind + memo, jeweils maximal). */
+#define ELTT_TX_WIRE_MAX \
+    (ELTT_MAX_ADDRESS_LEN + ELTT_MAX_ADDRESS_LEN + sizeof(double) + \
+     2 * sizeof(int) + ELTT_MAX_MEMO_LEN)
+
+void eltt_arena_init(eltt_arena *a, uint8_t *buf, size_t cap)
+{
+    a->buf = buf;
+    a->cap = cap;
+    a->used = 0;
+}
+
+void eltt_arena_reset(eltt_arena *a)
 {
-    size_t len = 0;
-    len += strlen(tx->from) + 1;
-    len += strlen(tx->to) + 1;
-    len += sizeof(double);
-    len += sizeof(int);
-    len += sizeof(int);
-    len += strlen(tx->memo) + 1;
+    a->used = 0;
+}
 
-    uint8_t *buf = (uint8_t *)malloc(len);
-    size_t pos = 0;
+/* Reserviert n Bytes in der Arena; NULL, wenn der Puffer nicht reicht. */
+uint8_t *eltt_arena_push(eltt_arena *a, size_t n)
+{
+    if (a->used + n > a->cap) {
+        return NULL;
+    }
+    uint8_t *p = a->buf + a->used;
+    a->used += n;
+    return p;
+}
 
+/* Serialisiert eine Transaktion in die Arena (gleiches Format wie die
+ * Streaming-Variante unten). Gibt den Anfang der Bytes zurück und legt
+ * die Länge in out_len ab; NULL bei voller Arena. */
+const uint8_t *eltt_serialize_transaction_into(const eltt_transaction *tx,
+                                                      eltt_arena *a,
+                                                      size_t *out_len)
+{
     size_t lfrom = strlen(tx->from) + 1;
+    size_t lto = strlen(tx->to) + 1;
+    size_t lmemo = strlen(tx->memo) + 1;
+    size_t len = lfrom + lto + sizeof(double) + 2 * sizeof(int) + lmemo;
+
+    uint8_t *buf = eltt_arena_push(a, len);
+    if (!buf) {
+        return NULL;
+    }
+    size_t pos = 0;
+
     memcpy(buf + pos, tx->from, lfrom);
     pos += lfrom;
-
-    size_t lto = strlen(tx->to) + 1;
     memcpy(buf + pos, tx->to, lto);
     pos += lto;
-
     memcpy(buf + pos, &tx->amount, sizeof(double));
     pos += sizeof(double);
-
     memcpy(buf + pos, &tx->token_index, sizeof(int));
     pos += sizeof(int);
-
     int kind = (int)tx->kind;
     memcpy(buf + pos, &kind, sizeof(int));
     pos += sizeof(int);
-
-    size_t lmemo = strlen(tx->memo) + 1;
     memcpy(buf + pos, tx->memo, lmemo);
     pos += lmemo;
 
-    *out = buf;
     *out_len = pos;
+    return buf;
 }
 
-static void eltt_serialize_block_header(const eltt_block *block, uint8_t **out, size_t *out_len)
+/* Serialisiert einen Block-Header in die Arena (gleiches Format wie
+ * die Streaming-Variante unten). */
+const uint8_t *eltt_serialize_block_header_into(const eltt_block *block,
+                                                       eltt_arena *a,
+                                                       size_t *out_len)
 {
-    size_t len = 0;
-    len += sizeof(uint32_t);
-    len += sizeof(uint64_t);
-    len += 32;
-    len += sizeof(size_t);
-
-    uint8_t *buf = (uint8_t *)malloc(len);
+    size_t len = sizeof(uint32_t) + sizeof(uint64_t) + 32 + 32 + sizeof(size_t);
+    uint8_t *buf = eltt_arena_push(a, len);
+    if (!buf) {
+        return NULL;
+    }
     size_t pos = 0;
 
     memcpy(buf + pos, &block->index, sizeof(uint32_t));
     pos += sizeof(uint32_t);
-
     memcpy(buf + pos, &block->timestamp, sizeof(uint64_t));
     pos += sizeof(uint64_t);
-
     memcpy(buf + pos, block->prev_hash, 32);
     pos += 32;
-
+    memcpy(buf + pos, block->merkle_root, 32);
+    pos += 32;
     memcpy(buf + pos, &block->tx_count, sizeof(size_t));
     pos += sizeof(size_t);
 
-    *out = buf;
     *out_len = pos;
+    return buf;
 }
 
-static void eltt_compute_block_hash(eltt_block *block)
+/* Streaming-Varianten: füttern die Felder direkt in einen laufenden
+ * SHA-256-Kontext — keine Allokation, keine Zwischenkopie. Byte-
+ * identisch zur Arena-Serialisierung oben. */
+
+static size_t eltt_sha256_update_transaction(eltt_sha256_ctx *ctx,
+                                             const eltt_transaction *tx)
 {
-    uint8_t *header = NULL;
-    size_t header_len = 0;
-    eltt_serialize_block_header(block, &header, &header_len);
+    size_t lfrom = strlen(tx->from) + 1;
+    size_t lto = strlen(tx->to) + 1;
+    size_t lmemo = strlen(tx->memo) + 1;
+    int kind = (int)tx->kind;
 
-    eltt_sha256(header, header_len, block->hash);
+    eltt_sha256_update(ctx, (const uint8_t *)tx->from, lfrom);
+    eltt_sha256_update(ctx, (const uint8_t *)tx->to, lto);
+    eltt_sha256_update(ctx, (const uint8_t *)&tx->amount, sizeof(double));
+    eltt_sha256_update(ctx, (const uint8_t *)&tx->token_index, sizeof(int));
+    eltt_sha256_update(ctx, (const uint8_t *)&kind, sizeof(int));
+    eltt_sha256_update(ctx, (const uint8_t *)tx->memo, lmemo);
 
-    free(header);
+    return lfrom + lto + sizeof(double) + 2 * sizeof(int) + lmemo;
 }
 
-/* ----------------------------------------------------------
- * Energie-Formel
- * ---------------------------------------------------------- */
-
-static double eltt_energy_from_transaction(const eltt_transaction *tx)
+static void eltt_sha256_update_block_header(eltt_sha256_ctx *ctx,
+                                            const eltt_block *block)
 {
-    uint8_t *serialized = NULL;
-    size_t serialized_len = 0;
-    eltt_serialize_transaction(tx, &serialized, &serialized_len);
-
-    double si_value = eltt_si_byte_value_from_size(serialized_len);
-    double bin_value = eltt_binary_byte_value_from_size(serialized_len);
-
-    uint8_t hash[32];
-    eltt_sha256(serialized, serialized_len, hash);
-
-    uint64_t last8 = 0;
-    for (int i = 24; i < 32; ++i) {
-        last8 = (last8 << 8) | hash[i];
-    }
-    double frac = (double)(last8 % 1000000000ULL) / 1000000000.0;
-
-    double energy = si_value + bin_value + frac;
+    eltt_sha256_update(ctx, (const uint8_t *)&block->index, sizeof(uint32_t));
+    eltt_sha256_update(ctx, (const uint8_t *)&block->timestamp, sizeof(uint64_t));
+    eltt_sha256_update(ctx, block->prev_hash, 32);
+    eltt_sha256_update(ctx, block->merkle_root, 32);
+    eltt_sha256_update(ctx, (const uint8_t *)&block->tx_count, sizeof(size_t));
+}
 
-    free(serialized);
-    return energy;
+/* Berechnet den Header-Hash, ohne den Block zu kopieren, zu verändern
+ * oder Heap-Speicher zu belegen; das Ergebnis landet in out_hash. */
+static void eltt_compute_block_hash_into(const eltt_block *block, uint8_t out_hash[32])
+{
+    eltt_sha256_ctx ctx;
+    eltt_sha256_init(&ctx);
+    eltt_sha256_update_block_header(&ctx, block);
+    eltt_sha256_final(&ctx, out_hash);
 }
 
 /* ----------------------------------------------------------
- * Token- und Wallet-Logik
+ * Merkle-Commitment über Transaktionen
+ *
+ * Der Block-Header enthält die Merkle-Wurzel über die serialisierten
+ * Transaktionen; der Header-Hash bindet damit die Transaktions-
+ * inhalte. Blätter sind SHA-256 über die Arena-Serialisierung einer
+ * Transaktion und werden im Batch gehasht (AVX2-Pfad, 8 Blätter
+ * parallel). Innere Knoten: SHA-256 über die 64 Bytes beider Kinder;
+ * ein ungerader letzter Knoten wird unverändert hochgereicht.
+ * Einschluss-Beweise sind dadurch Geschwister-Pfade der Länge
+ * O(log tx_count); Ebenen ohne Geschwister entfallen.
  * ---------------------------------------------------------- */
 
-static int eltt_find_wallet_index(const eltt_blockchain *bc, const char *address)
+/* Blatt-Hashes aller Transaktionen eines Blocks in einem Batch. */
+static void eltt_merkle_leaf_hashes(const eltt_transaction *txs, size_t n,
+                                    uint8_t (*leaves)[32])
 {
-    for (size_t i = 0; i < bc->wallet_count; ++i) {
-        if (strcmp(bc->wallets[i].address, address) == 0) {
-            return (int)i;
-        }
+    /* Hash-Prüfungen laufen auch parallel (Validator-Worker,
+     * Pipeline-Ingestion) — die Scratch-Puffer sind deshalb
+     * thread-lokal, anders als im seriellen Apply-Pfad. */
+    static _Thread_local uint8_t wire[ELTT_MAX_TX_PER_BLOCK * ELTT_TX_WIRE_MAX];
+    static _Thread_local const uint8_t *msgs[ELTT_MAX_TX_PER_BLOCK];
+    static _Thread_local size_t lens[ELTT_MAX_TX_PER_BLOCK];
+
+    eltt_arena arena;
+    eltt_arena_init(&arena, wire, sizeof(wire));
+    for (size_t i = 0; i < n; ++i) {
+        msgs[i] = eltt_serialize_transaction_into(&txs[i], &arena, &lens[i]);
     }
-    return -1;
+    eltt_sha256_batch(msgs, lens, n, leaves);
 }
 
-static int eltt_add_wallet(eltt_blockchain *bc, const char *address)
+/* Faltet eine Ebene von Knoten-Hashes in-place zur Wurzel zusammen. */
+static void eltt_merkle_fold(uint8_t (*nodes)[32], size_t n, uint8_t out[32])
 {
-    if (bc->wallet_count >= ELTT_MAX_WALLETS) {
-        return -1;
+    if (n == 0) {
+        memset(out, 0, 32);
+        return;
     }
-    int idx = (int)bc->wallet_count;
-    eltt_wallet *w = &bc->wallets[idx];
-    memset(w, 0, sizeof(*w));
-    strncpy(w->address, address, ELTT_MAX_ADDRESS_LEN - 1);
-    w->address[ELTT_MAX_ADDRESS_LEN - 1] = '\0';
-    w->token_count = bc->token_count;
-    for (size_t i = 0; i < bc->token_count; ++i) {
-        w->balances[i] = 0.0;
+    while (n > 1) {
+        size_t parents = 0;
+        for (size_t i = 0; i + 1 < n; i += 2) {
+            uint8_t pair[64];
+            memcpy(pair, nodes[i], 32);
+            memcpy(pair + 32, nodes[i + 1], 32);
+            eltt_sha256(pair, sizeof(pair), nodes[parents]);
+            parents++;
+        }
+        if (n & 1) {
+            memcpy(nodes[parents], nodes[n - 1], 32);
+            parents++;
+        }
+        n = parents;
     }
-    bc->wallet_count++;
-    return idx;
+    memcpy(out, nodes[0], 32);
 }
 
-static int eltt_find_or_create_wallet(eltt_blockchain *bc, const char *address)
+static void eltt_compute_merkle_root(const eltt_transaction *txs, size_t n,
+                                     uint8_t out[32])
 {
-    int idx = eltt_find_wallet_index(bc, address);
-    if (idx >= 0) {
-        return idx;
+    static _Thread_local uint8_t nodes[ELTT_MAX_TX_PER_BLOCK][32];
+    if (n > ELTT_MAX_TX_PER_BLOCK) {
+        n = ELTT_MAX_TX_PER_BLOCK;
     }
-    return eltt_add_wallet(bc, address);
+    eltt_merkle_leaf_hashes(txs, n, nodes);
+    eltt_merkle_fold(nodes, n, out);
 }
 
-static int eltt_add_token_type(eltt_blockchain *bc,
-                               const char *name,
-                               const char *symbol,
-                               int decimals,
+/* Inkrementeller Aufbau während ein Block zusammengestellt wird:
+ * add() hasht genau ein Blatt, root() faltet die gesammelten Blätter.
+ * Die Blätter bleiben erhalten, ein wachsender Block kostet damit pro
+ * neuer Transaktion nur einen Blatt-Hash. */
+typedef struct {
+    size_t  count;
+    uint8_t leaves[ELTT_MAX_TX_PER_BLOCK][32];
+} eltt_merkle_builder;
+
+void eltt_merkle_builder_init(eltt_merkle_builder *b)
+{
+    b->count = 0;
+}
+
+int eltt_merkle_builder_add(eltt_merkle_builder *b, const eltt_transaction *tx)
+{
+    if (b->count >= ELTT_MAX_TX_PER_BLOCK) {
+        return 0;
+    }
+    eltt_sha256_ctx ctx;
+    eltt_sha256_init(&ctx);
+    eltt_sha256_update_transaction(&ctx, tx);
+    eltt_sha256_final(&ctx, b->leaves[b->count]);
+    b->count++;
+    return 1;
+}
+
+void eltt_merkle_builder_root(const eltt_merkle_builder *b, uint8_t out[32])
+{
+    static _Thread_local uint8_t nodes[ELTT_MAX_TX_PER_BLOCK][32];
+    memcpy(nodes, b->leaves, b->count * 32);
+    eltt_merkle_fold(nodes, b->count, out);
+}
+
+/* Einschluss-Beweis für Transaktion tx_index: Geschwister-Hashes von
+ * unten nach oben; out_is_left[i] = 1, wenn das Geschwister links
+ * steht. Gibt die Beweislänge zurück (0 auch bei tx_count <= 1). */
+size_t eltt_merkle_proof_build(const eltt_transaction *txs, size_t tx_count,
+                               size_t tx_index,
+                               uint8_t (*out_siblings)[32],
+                               uint8_t *out_is_left, size_t max_depth)
+{
+    if (tx_index >= tx_count || tx_count > ELTT_MAX_TX_PER_BLOCK) {
+        return 0;
+    }
+    static _Thread_local uint8_t nodes[ELTT_MAX_TX_PER_BLOCK][32];
+    eltt_merkle_leaf_hashes(txs, tx_count, nodes);
+
+    size_t depth = 0;
+    size_t pos = tx_index;
+    size_t n = tx_count;
+    while (n > 1) {
+        size_t sibling = pos ^ 1;
+        if (sibling < n) {
+            if (depth >= max_depth) {
+                return 0;
+            }
+            memcpy(out_siblings[depth], nodes[sibling], 32);
+            out_is_left[depth] = (uint8_t)(sibling < pos);
+            depth++;
+        }
+        /* Ebene falten (wie eltt_merkle_fold, eine Stufe) */
+        size_t parents = 0;
+        for (size_t i = 0; i + 1 < n; i += 2) {
+            uint8_t pair[64];
+            memcpy(pair, nodes[i], 32);
+            memcpy(pair + 32, nodes[i + 1], 32);
+            eltt_sha256(pair, sizeof(pair), nodes[parents]);
+            parents++;
+        }
+        if (n & 1) {
+            memcpy(nodes[parents], nodes[n - 1], 32);
+            parents++;
+        }
+        pos /= 2;
+        n = parents;
+    }
+    return depth;
+}
+
+/* Prüft einen Einschluss-Beweis gegen eine erwartete Wurzel. */
+int eltt_merkle_proof_verify(const eltt_transaction *tx,
+                             const uint8_t (*siblings)[32],
+                             const uint8_t *is_left, size_t depth,
+                             const uint8_t expected_root[32])
+{
+    uint8_t node[32];
+    eltt_sha256_ctx ctx;
+    eltt_sha256_init(&ctx);
+    eltt_sha256_update_transaction(&ctx, tx);
+    eltt_sha256_final(&ctx, node);
+
+    for (size_t i = 0; i < depth; ++i) {
+        uint8_t pair[64];
+        if (is_left[i]) {
+            memcpy(pair, siblings[i], 32);
+            memcpy(pair + 32, node, 32);
+        } else {
+            memcpy(pair, node, 32);
+            memcpy(pair + 32, siblings[i], 32);
+        }
+        eltt_sha256(pair, sizeof(pair), node);
+    }
+    return memcmp(node, expected_root, 32) == 0;
+}
+
+static void eltt_compute_block_hash(eltt_block *block)
+{
+    eltt_compute_merkle_root(block->txs, block->tx_count, block->merkle_root);
+    eltt_compute_block_hash_into(block, block->hash);
+}
+
+/* ----------------------------------------------------------
+ * Energie-Formel
+ * ---------------------------------------------------------- */
+
+/* ----------------------------------------------------------
+ * Energie-Cache
+ *
+ * Die Energie ist eine reine Funktion der Transaktions-Bytes. Wiederholte
+ * Abfragen derselben historischen Transaktionen (Chain-Grid im Viewer)
+ * werden über einen fest großen, direkt abgebildeten Cache beantwortet:
+ * Schlüssel ist ein billiger 64-Bit-FNV-1a über dieselben Felder wie die
+ * Serialisierung — ein Schlüssel aus dem SHA-256-Inhaltshash würde genau
+ * die Arbeit kosten, die der Cache einsparen soll. Der Cache ist
+ * prozessglobal, da die Energie nicht vom Chain-Zustand abhängt.
+ * ---------------------------------------------------------- */
+
+#define ELTT_ENERGY_CACHE_CAP 4096  /* Zweierpotenz */
+
+typedef struct {
+    uint64_t key;     /* Inhalts-Schlüssel (FNV-1a, 64 Bit) */
+    double   energy;
+    uint8_t  valid;
+} eltt_energy_cache_entry;
+
+static eltt_energy_cache_entry eltt_energy_cache[ELTT_ENERGY_CACHE_CAP];
+
+/* 64-Bit-FNV-1a über die Serialisierungsfelder der Transaktion;
+ * deckt dieselben Bytes ab wie eltt_sha256_update_transaction(). */
+static uint64_t eltt_transaction_content_key(const eltt_transaction *tx)
+{
+    uint64_t h = 14695981039346656037ULL;
+    const uint8_t *parts[6];
+    size_t lens[6];
+    int kind = (int)tx->kind;
+
+    parts[0] = (const uint8_t *)tx->from;   lens[0] = strlen(tx->from) + 1;
+    parts[1] = (const uint8_t *)tx->to;     lens[1] = strlen(tx->to) + 1;
+    parts[2] = (const uint8_t *)&tx->amount;      lens[2] = sizeof(double);
+    parts[3] = (const uint8_t *)&tx->token_index; lens[3] = sizeof(int);
+    parts[4] = (const uint8_t *)&kind;            lens[4] = sizeof(int);
+    parts[5] = (const uint8_t *)tx->memo;   lens[5] = strlen(tx->memo) + 1;
+
+    for (int p = 0; p < 6; ++p) {
+        for (size_t i = 0; i < lens[p]; ++i) {
+            h ^= parts[p][i];
+            h *= 1099511628211ULL;
+        }
+    }
+    return h;
+}
+
+static double eltt_energy_from_transaction_uncached(const eltt_transaction *tx)
+{
+    /* Streaming-Serialisierung direkt in den Hash-Kontext: die
+     * Energie-Abfrage kommt ohne Heap-Allokation und ohne
+     * Zwischenpuffer aus. */
+    eltt_sha256_ctx ctx;
+    eltt_sha256_init(&ctx);
+    size_t serialized_len = eltt_sha256_update_transaction(&ctx, tx);
+
+    uint8_t hash[32];
+    eltt_sha256_final(&ctx, hash);
+
+    double si_value = eltt_si_byte_value_from_size(serialized_len);
+    double bin_value = eltt_binary_byte_value_from_size(serialized_len);
+
+    uint64_t last8 = 0;
+    for (int i = 24; i < 32; ++i) {
+        last8 = (last8 << 8) | hash[i];
+    }
+    double frac = (double)(last8 % 1000000000ULL) / 1000000000.0;
+
+    return si_value + bin_value + frac;
+}
+
+static double eltt_energy_from_transaction(const eltt_transaction *tx)
+{
+    uint64_t key = eltt_transaction_content_key(tx);
+    eltt_energy_cache_entry *e =
+        &eltt_energy_cache[key & (ELTT_ENERGY_CACHE_CAP - 1)];
+    if (e->valid && e->key == key) {
+        eltt_stats_add(&eltt_stats_state.energy_cache_hits, 1);
+        return e->energy;
+    }
+
+    eltt_stats_add(&eltt_stats_state.energy_cache_misses, 1);
+    double energy = eltt_energy_from_transaction_uncached(tx);
+    e->key = key;
+    e->energy = energy;
+    e->valid = 1;
+    return energy;
+}
+
+/* Energie für einen Transaktions-Bereich in einem Batch: alle
+ * Cache-Misses werden gemeinsam in eine Arena serialisiert und durch
+ * den mehrspurigen SHA-256-Pfad gehasht; die Byte-Wert-Anteile fallen
+ * pro Transaktion als reine Arithmetik über die Serialisierungslänge
+ * an. Treffer kommen wie gehabt aus dem Energie-Cache, Misses werden
+ * eingetragen. Bitidentisch zu n Einzelaufrufen. */
+static void eltt_energy_batch_chunk(const eltt_transaction *txs, size_t n,
+                                    double *out)
+{
+    static _Thread_local uint8_t wire[ELTT_MAX_TX_PER_BLOCK * ELTT_TX_WIRE_MAX];
+    static _Thread_local const uint8_t *msgs[ELTT_MAX_TX_PER_BLOCK];
+    static _Thread_local size_t lens[ELTT_MAX_TX_PER_BLOCK];
+    static _Thread_local uint8_t hashes[ELTT_MAX_TX_PER_BLOCK][32];
+    static _Thread_local uint64_t keys[ELTT_MAX_TX_PER_BLOCK];
+    static _Thread_local size_t miss[ELTT_MAX_TX_PER_BLOCK];
+
+    size_t miss_count = 0;
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = eltt_transaction_content_key(&txs[i]);
+        const eltt_energy_cache_entry *e =
+            &eltt_energy_cache[keys[i] & (ELTT_ENERGY_CACHE_CAP - 1)];
+        if (e->valid && e->key == keys[i]) {
+            eltt_stats_add(&eltt_stats_state.energy_cache_hits, 1);
+            out[i] = e->energy;
+        } else {
+            miss[miss_count++] = i;
+        }
+    }
+    if (miss_count == 0) {
+        return;
+    }
+    eltt_stats_add(&eltt_stats_state.energy_cache_misses, miss_count);
+
+    eltt_arena arena;
+    eltt_arena_init(&arena, wire, sizeof(wire));
+    for (size_t m = 0; m < miss_count; ++m) {
+        msgs[m] = eltt_serialize_transaction_into(&txs[miss[m]], &arena, &lens[m]);
+    }
+    eltt_sha256_batch(msgs, lens, miss_count, hashes);
+
+    for (size_t m = 0; m < miss_count; ++m) {
+        size_t i = miss[m];
+        double si_value = eltt_si_byte_value_from_size(lens[m]);
+        double bin_value = eltt_binary_byte_value_from_size(lens[m]);
+        uint64_t last8 = 0;
+        for (int b = 24; b < 32; ++b) {
+            last8 = (last8 << 8) | hashes[m][b];
+        }
+        double frac = (double)(last8 % 1000000000ULL) / 1000000000.0;
+        out[i] = si_value + bin_value + frac;
+
+        eltt_energy_cache_entry *e =
+            &eltt_energy_cache[keys[i] & (ELTT_ENERGY_CACHE_CAP - 1)];
+        e->key = keys[i];
+        e->energy = out[i];
+        e->valid = 1;
+    }
+}
+
+/* ----------------------------------------------------------
+ * Materialisierte Sichten
+ * ---------------------------------------------------------- */
+
+static void eltt_view_mark(eltt_blockchain *bc, eltt_view_kind kind)
+{
+    bc->view_generations[kind]++;
+}
+
+/* Aktualisiert genau die Zeile des berührten Pools in der
+ * materialisierten Pool-Ansicht. */
+static void eltt_view_sync_pool(eltt_blockchain *bc, size_t pool_idx)
+{
+    const eltt_liquidity_pool *p = &bc->pools[pool_idx];
+    eltt_pool_view_entry *e = &bc->pool_view[pool_idx];
+    e->pool_index = (int)pool_idx;
+    e->token_x_index = p->token_x_index;
+    e->token_y_index = p->token_y_index;
+    e->reserve_x = p->reserve_x;
+    e->reserve_y = p->reserve_y;
+    e->lp_token_index = p->lp_token_index;
+    if (pool_idx >= bc->pool_view_count) {
+        bc->pool_view_count = pool_idx + 1;
+    }
+    eltt_view_mark(bc, ELTT_VIEW_POOLS);
+}
+
+/* ----------------------------------------------------------
+ * Token- und Wallet-Logik
+ * ---------------------------------------------------------- */
+
+/* Deterministischer FNV-1a-Hash über die Adress-Bytes. */
+static uint32_t eltt_address_hash(const char *address)
+{
+    uint32_t h = 2166136261u;
+    const unsigned char *p = (const unsigned char *)address;
+    while (*p) {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* ----------------------------------------------------------
+ * Adress-Interning
+ *
+ * Prozess-globale Tabelle (wie der Energie-Cache): Adresse -> dichte
+ * ID beim ersten Auftreten, ID -> String für Serialisierung. Gepflegt
+ * wird sie nur auf den seriellen Pfaden (Aufnahme, Laden, Anwenden);
+ * parallele Leser (Fork-Views, Validator-Worker) bleiben auf dem
+ * String-Pfad und fassen die Tabelle nicht an.
+ * ---------------------------------------------------------- */
+
+typedef struct {
+    uint32_t count;                                      /* vergebene IDs */
+    char     strings[ELTT_INTERN_MAX_IDS][ELTT_MAX_ADDRESS_LEN]; /* [id-1] */
+    uint32_t map[ELTT_INTERN_MAP_CAP];                   /* 0 = leer */
+} eltt_intern_table;
+
+static eltt_intern_table eltt_intern_state;
+
+/* Interniert eine Adresse (vergibt beim ersten Auftreten die nächste
+ * dichte ID). Gibt 0 zurück, wenn die Tabelle voll ist — Aufrufer
+ * fallen dann auf den String-Pfad zurück. */
+uint32_t eltt_address_intern(const char *address)
+{
+    uint32_t slot = eltt_address_hash(address) & (ELTT_INTERN_MAP_CAP - 1);
+    while (eltt_intern_state.map[slot]) {
+        uint32_t id = eltt_intern_state.map[slot];
+        if (strcmp(eltt_intern_state.strings[id - 1], address) == 0) {
+            return id;
+        }
+        slot = (slot + 1) & (ELTT_INTERN_MAP_CAP - 1);
+    }
+    if (eltt_intern_state.count >= ELTT_INTERN_MAX_IDS) {
+        return 0;
+    }
+    uint32_t id = ++eltt_intern_state.count;
+    strncpy(eltt_intern_state.strings[id - 1], address, ELTT_MAX_ADDRESS_LEN - 1);
+    eltt_intern_state.strings[id - 1][ELTT_MAX_ADDRESS_LEN - 1] = '\0';
+    eltt_intern_state.map[slot] = id;
+    return id;
+}
+
+/* String-Form einer ID; NULL bei 0 oder unvergebener ID. */
+const char *eltt_address_from_id(uint32_t id)
+{
+    if (id == 0 || id > eltt_intern_state.count) {
+        return NULL;
+    }
+    return eltt_intern_state.strings[id - 1];
+}
+
+/* Setzt die Interning-Tabelle zurück (Tests, Prozess-Neustart-
+ * Simulation). Vorsicht: bereits vergebene IDs in lebenden
+ * Blockchains werden dadurch ungültig. */
+void eltt_address_intern_reset(void)
+{
+    memset(&eltt_intern_state, 0, sizeof(eltt_intern_state));
+}
+
+/* Füllt den Interning-Cache aller Transaktionen eines Blocks (in der
+ * Arena-Kopie, nie im Puffer des Aufrufers). */
+static void eltt_block_intern_ids(eltt_block *block)
+{
+    for (size_t i = 0; i < block->tx_count; ++i) {
+        block->txs[i].from_id = eltt_address_intern(block->txs[i].from);
+        block->txs[i].to_id   = eltt_address_intern(block->txs[i].to);
+    }
+}
+
+static void eltt_wallet_index_reset(eltt_blockchain *bc)
+{
+    for (size_t i = 0; i < ELTT_WALLET_INDEX_CAP; ++i) {
+        bc->wallet_index_map[i] = -1;
+    }
+    for (size_t i = 0; i <= ELTT_INTERN_MAX_IDS; ++i) {
+        bc->id_to_wallet[i] = -1;
+    }
+}
+
+static void eltt_wallet_index_insert(eltt_blockchain *bc, const char *address, int wallet_idx)
+{
+    uint32_t slot = eltt_address_hash(address) & (ELTT_WALLET_INDEX_CAP - 1);
+    while (bc->wallet_index_map[slot] >= 0) {
+        slot = (slot + 1) & (ELTT_WALLET_INDEX_CAP - 1);
+    }
+    bc->wallet_index_map[slot] = (int32_t)wallet_idx;
+}
+
+static int eltt_find_wallet_index(const eltt_blockchain *bc, const char *address)
+{
+    eltt_stats_add(&eltt_stats_state.wallet_lookups, 1);
+    uint32_t slot = eltt_address_hash(address) & (ELTT_WALLET_INDEX_CAP - 1);
+    while (bc->wallet_index_map[slot] >= 0) {
+        int32_t idx = bc->wallet_index_map[slot];
+        if (strcmp(bc->wallets[idx].address, address) == 0) {
+            return (int)idx;
+        }
+        slot = (slot + 1) & (ELTT_WALLET_INDEX_CAP - 1);
+    }
+    return -1;
+}
+
+/* Wallet-Index über den Interning-Cache einer Transaktion: ein
+ * Array-Zugriff statt Hash und strcmp. Fällt für nicht internierte
+ * Adressen (ID 0, etwa Tabelle voll oder Puffer des Aufrufers) auf
+ * den Adress-Index zurück. */
+static int eltt_find_wallet_index_by_id(const eltt_blockchain *bc,
+                                        uint32_t id, const char *address)
+{
+    if (id) {
+        return (int)bc->id_to_wallet[id];
+    }
+    return eltt_find_wallet_index(bc, address);
+}
+
+static int eltt_add_wallet(eltt_blockchain *bc, const char *address)
+{
+    if (bc->wallet_count >= ELTT_MAX_WALLETS) {
+        return -1;
+    }
+    int idx = (int)bc->wallet_count;
+    eltt_wallet *w = &bc->wallets[idx];
+    memset(w, 0, sizeof(*w));
+    strncpy(w->address, address, ELTT_MAX_ADDRESS_LEN - 1);
+    w->address[ELTT_MAX_ADDRESS_LEN - 1] = '\0';
+    for (size_t t = 0; t < bc->token_count; ++t) {
+        bc->wallet_balances[t][idx] = 0;
+    }
+    bc->wallet_count++;
+    eltt_wallet_index_insert(bc, w->address, idx);
+    {
+        uint32_t id = eltt_address_intern(w->address);
+        if (id) {
+            bc->id_to_wallet[id] = (int32_t)idx;
+        }
+    }
+    eltt_view_mark(bc, ELTT_VIEW_WALLETS);
+    eltt_stats_add(&eltt_stats_state.wallets_created, 1);
+    return idx;
+}
+
+static int eltt_find_or_create_wallet(eltt_blockchain *bc, const char *address)
+{
+    int idx = eltt_find_wallet_index(bc, address);
+    if (idx >= 0) {
+        return idx;
+    }
+    return eltt_add_wallet(bc, address);
+}
+
+static int eltt_add_token_type(eltt_blockchain *bc,
+                               const char *name,
+                               const char *symbol,
+                               int decimals,
                                eltt_token_kind kind,
                                double energy_binding_factor)
 {
@@ -546,223 +1782,2497 @@ static int eltt_add_token_type(eltt_blockchain *bc,
     t->kind = kind;
     t->energy_binding_factor = energy_binding_factor;
     bc->token_count++;
-    for (size_t i = 0; i < bc->wallet_count; ++i) {
-        bc->wallets[i].balances[idx] = 0.0;
-        bc->wallets[i].token_count = bc->token_count;
+    /* Die Guthaben-Zeile des neuen Tokens einmal nullen; ein Walk über
+     * alle Wallets ist nicht mehr nötig. */
+    memset(bc->wallet_balances[idx], 0, sizeof(bc->wallet_balances[idx]));
+    return idx;
+}
+
+/* ----------------------------------------------------------
+ * Aktivitäts-Index
+ * ---------------------------------------------------------- */
+
+/* Hängt eine Transaktions-Referenz an die Posting-Liste der Wallet an.
+ * Allokationsfehler lassen den Index lediglich unvollständig; der
+ * Chain-Zustand selbst bleibt korrekt. */
+static void eltt_activity_push(eltt_blockchain *bc, int wallet_idx,
+                               uint32_t block_index, uint32_t tx_index)
+{
+    if (wallet_idx < 0) {
+        return;
+    }
+    eltt_activity_list *list = &bc->activity[wallet_idx];
+    if (list->count == list->cap) {
+        size_t new_cap = (list->cap == 0) ? 8 : list->cap * 2;
+        eltt_tx_ref *refs =
+            (eltt_tx_ref *)realloc(list->refs, new_cap * sizeof(eltt_tx_ref));
+        if (!refs) {
+            return;
+        }
+        list->refs = refs;
+        list->cap = new_cap;
+        eltt_stats_add(&eltt_stats_state.activity_grows, 1);
+    }
+    list->refs[list->count].block_index = block_index;
+    list->refs[list->count].tx_index = tx_index;
+    list->count++;
+}
+
+/* Indiziert die Transaktionen eines frisch aufgenommenen Blocks für
+ * Absender und Empfänger (einmal, falls identisch). */
+static void eltt_activity_index_block(eltt_blockchain *bc, const eltt_block *block)
+{
+    for (size_t t = 0; t < block->tx_count; ++t) {
+        const eltt_transaction *tx = &block->txs[t];
+        int from_idx = eltt_find_wallet_index_by_id(bc, tx->from_id, tx->from);
+        int to_idx   = eltt_find_wallet_index_by_id(bc, tx->to_id, tx->to);
+        eltt_activity_push(bc, from_idx, block->index, (uint32_t)t);
+        if (to_idx != from_idx) {
+            eltt_activity_push(bc, to_idx, block->index, (uint32_t)t);
+        }
+    }
+}
+
+/* ----------------------------------------------------------
+ * Adress-Bloom-Filter je Block
+ * ---------------------------------------------------------- */
+
+/* FNV-1a über den Adress-String; die zwei Bit-Positionen werden aus
+ * disjunkten Teilen des 64-Bit-Hashes abgeleitet. */
+static uint64_t eltt_bloom_hash(const char *address)
+{
+    uint64_t h = 1469598103934665603ULL;
+    for (const char *p = address; *p; ++p) {
+        h ^= (uint8_t)*p;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static void eltt_bloom_set(uint8_t *bloom, const char *address)
+{
+    uint64_t h = eltt_bloom_hash(address);
+    uint32_t b1 = (uint32_t)(h & (ELTT_BLOOM_BYTES * 8 - 1));
+    uint32_t b2 = (uint32_t)((h >> 32) & (ELTT_BLOOM_BYTES * 8 - 1));
+    bloom[b1 >> 3] |= (uint8_t)(1u << (b1 & 7));
+    bloom[b2 >> 3] |= (uint8_t)(1u << (b2 & 7));
+}
+
+static int eltt_bloom_test(const uint8_t *bloom, const char *address)
+{
+    uint64_t h = eltt_bloom_hash(address);
+    uint32_t b1 = (uint32_t)(h & (ELTT_BLOOM_BYTES * 8 - 1));
+    uint32_t b2 = (uint32_t)((h >> 32) & (ELTT_BLOOM_BYTES * 8 - 1));
+    return (bloom[b1 >> 3] & (1u << (b1 & 7))) &&
+           (bloom[b2 >> 3] & (1u << (b2 & 7)));
+}
+
+/* Filter von Block i oder NULL, falls der Chunk (noch) fehlt. */
+static const uint8_t *eltt_block_bloom(const eltt_blockchain *bc, size_t i)
+{
+    const uint8_t *chunk = bc->bloom_chunks[i / ELTT_BLOCKS_PER_CHUNK];
+    if (!chunk) {
+        return NULL;
+    }
+    return chunk + (i % ELTT_BLOCKS_PER_CHUNK) * ELTT_BLOOM_BYTES;
+}
+
+/* Baut den Filter eines frisch aufgenommenen Blocks über die from/to-
+ * Adressen seiner Transaktionen. Allokationsfehler lassen den Filter
+ * lediglich fehlen (NULL-Chunk); Abfragen scannen solche Blöcke dann
+ * regulär — der Chain-Zustand selbst ist nicht betroffen. */
+static void eltt_bloom_index_block(eltt_blockchain *bc, const eltt_block *block)
+{
+    size_t chunk = (size_t)block->index / ELTT_BLOCKS_PER_CHUNK;
+    if (chunk >= ELTT_MAX_BLOCK_CHUNKS) {
+        return;
+    }
+    if (!bc->bloom_chunks[chunk]) {
+        bc->bloom_chunks[chunk] = (uint8_t *)calloc(
+            ELTT_BLOCKS_PER_CHUNK, ELTT_BLOOM_BYTES);
+        if (!bc->bloom_chunks[chunk]) {
+            return;
+        }
+    }
+    uint8_t *bloom = bc->bloom_chunks[chunk] +
+                     ((size_t)block->index % ELTT_BLOCKS_PER_CHUNK) * ELTT_BLOOM_BYTES;
+    memset(bloom, 0, ELTT_BLOOM_BYTES);
+    for (size_t t = 0; t < block->tx_count; ++t) {
+        eltt_bloom_set(bloom, block->txs[t].from);
+        eltt_bloom_set(bloom, block->txs[t].to);
+    }
+}
+
+/* ----------------------------------------------------------
+ * Validierung von Transaktionen
+ * ---------------------------------------------------------- */
+
+static int eltt_validate_transaction(const eltt_blockchain *bc, const eltt_transaction *tx)
+{
+    if (tx->token_index < 0 || (size_t)tx->token_index >= bc->token_count) {
+        return 0;
+    }
+    if (tx->amount < 0.0) {
+        return 0;
+    }
+
+    int from_idx = eltt_find_wallet_index_by_id(bc, tx->from_id, tx->from);
+    int to_idx   = eltt_find_wallet_index_by_id(bc, tx->to_id, tx->to);
+    eltt_amount_fp amount_fp = eltt_fp_from_double(tx->amount);
+
+    switch (tx->kind) {
+        case ELTT_TX_KIND_TRANSFER:
+        case ELTT_TX_KIND_SWAP:
+        case ELTT_TX_KIND_STAKE:
+            if (from_idx < 0) return 0;
+            if (bc->wallet_balances[tx->token_index][from_idx] < amount_fp) return 0;
+            if (amount_fp <= 0) return 0;
+            break;
+        case ELTT_TX_KIND_MINT:
+            if (to_idx < 0) return 0;
+            if (amount_fp <= 0) return 0;
+            break;
+        case ELTT_TX_KIND_BURN:
+            if (from_idx < 0) return 0;
+            if (bc->wallet_balances[tx->token_index][from_idx] < amount_fp) return 0;
+            if (amount_fp <= 0) return 0;
+            break;
+        case ELTT_TX_KIND_CREATE_TOKEN:
+        case ELTT_TX_KIND_CREATE_POOL:
+        case ELTT_TX_KIND_ADD_LIQUIDITY:
+        case ELTT_TX_KIND_REMOVE_LIQUIDITY:
+        case ELTT_TX_KIND_UNSTAKE:
+        case ELTT_TX_KIND_CLAIM_REWARDS:
+        case ELTT_TX_KIND_PROFILE_UPDATE:
+        case ELTT_TX_KIND_GOVERNANCE_PROPOSAL:
+            break;
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+/* ----------------------------------------------------------
+ * Staking-Accrual (Akkumulator-Technik)
+ *
+ * Statt pro Tick über alle Positionen zu laufen, wird pro Block genau
+ * ein Akkumulator je Token um die in der Zwischenzeit angefallenen
+ * Rewards pro gestaketem Token erhöht. Jede Position merkt sich beim
+ * Stake/Unstake/Claim den Akkumulatorstand; ihre ausstehenden Rewards
+ * sind damit jederzeit in O(1) berechenbar.
+ * ---------------------------------------------------------- */
+
+/* Schreibt die Akkumulatoren bis zum Zeitstempel ts fort. Wird einmal
+ * pro angewendetem Block aufgerufen; rückwärts laufende Zeitstempel
+ * werden ignoriert (Monotonie erzwingt der Validator ohnehin). */
+static void eltt_stake_accrue(eltt_blockchain *bc, uint64_t ts)
+{
+    if (bc->stake_accrual_timestamp == 0) {
+        bc->stake_accrual_timestamp = ts;
+        return;
+    }
+    if (ts <= bc->stake_accrual_timestamp) {
+        return;
+    }
+    double dt = (double)(ts - bc->stake_accrual_timestamp);
+    double per_unit = ELTT_STAKE_APR * dt / ELTT_STAKE_SECONDS_PER_YEAR;
+    for (size_t t = 0; t < bc->token_count; ++t) {
+        bc->stake_reward_per_token[t] += per_unit;
+    }
+    bc->stake_accrual_timestamp = ts;
+}
+
+/* Ausstehende (noch nicht festgeschriebene) Rewards einer Position. */
+static double eltt_stake_position_pending(const eltt_blockchain *bc,
+                                          const eltt_staking_position *pos)
+{
+    return pos->amount * (bc->stake_reward_per_token[pos->token_index] -
+                          pos->reward_per_token_snap);
+}
+
+/* Schreibt die ausstehenden Rewards in accumulated_rewards fest und
+ * setzt den Snapshot auf den aktuellen Akkumulatorstand. Muss vor
+ * jeder Änderung von amount passieren. */
+static void eltt_stake_position_settle(const eltt_blockchain *bc,
+                                       eltt_staking_position *pos)
+{
+    pos->accumulated_rewards += eltt_stake_position_pending(bc, pos);
+    pos->reward_per_token_snap = bc->stake_reward_per_token[pos->token_index];
+}
+
+/* Position von owner für einen Token; -1 falls keine existiert.
+ * Linearer Scan — Stake/Unstake/Claim sind seltene Mutationen, die
+ * heißen Lese-Pfade laufen über eltt_stake_position_pending(). */
+static int eltt_stake_find_position(const eltt_blockchain *bc,
+                                    const char *owner, int token_index)
+{
+    for (size_t i = 0; i < bc->stake_count; ++i) {
+        if (bc->stakes[i].token_index == token_index &&
+            strcmp(bc->stakes[i].owner, owner) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+/* ----------------------------------------------------------
+ * Batch-Anwendung eines Blocks
+ *
+ * Statt pro Transaktion zwei Wallet-Lookups und zwei Guthaben-Zellen
+ * anzufassen, läuft die Anwendung in drei Pässen:
+ *   1. Alle Adressen des Blocks einmal auflösen (lokales Memo, Wallets
+ *      entstehen in Erst-Auftretens-Reihenfolge wie beim sequentiellen
+ *      Anwenden).
+ *   2. Guthaben-Deltas pro (Wallet, Token) akkumulieren.
+ *   3. Akkumulierte Deltas anwenden — jede Guthaben-Zelle wird einmal
+ *      pro Block berührt statt einmal pro Transaktion.
+ * Das Endergebnis ist identisch zur sequentiellen Anwendung, da alle
+ * Guthaben-Operationen additiv sind.
+ * ---------------------------------------------------------- */
+
+/* Lokales Adress-Memo (Zweierpotenz, > 2 * 2 * ELTT_MAX_TX_PER_BLOCK). */
+#define ELTT_APPLY_MEMO_CAP  2048
+
+/* Delta-Map (Zweierpotenz, > 2 * 2 * ELTT_MAX_TX_PER_BLOCK Paare). */
+#define ELTT_APPLY_DELTA_CAP 2048
+
+typedef struct {
+    const char *address;  /* NULL = leer; zeigt in die Block-Transaktionen */
+    int32_t     wallet_idx;
+} eltt_apply_memo_slot;
+
+typedef struct {
+    int32_t wallet_idx;   /* -1 = leer */
+    int32_t token_idx;
+    eltt_amount_fp delta;
+} eltt_apply_delta_slot;
+
+/* Adresse über das Block-lokale Memo auflösen; erst beim ersten
+ * Auftreten wird der globale Index (und ggf. eltt_add_wallet) bemüht. */
+static int eltt_apply_resolve(eltt_blockchain *bc,
+                              eltt_apply_memo_slot *memo,
+                              const char *address)
+{
+    uint32_t slot = eltt_address_hash(address) & (ELTT_APPLY_MEMO_CAP - 1);
+    while (memo[slot].address) {
+        if (strcmp(memo[slot].address, address) == 0) {
+            return memo[slot].wallet_idx;
+        }
+        slot = (slot + 1) & (ELTT_APPLY_MEMO_CAP - 1);
+    }
+    int idx = eltt_find_or_create_wallet(bc, address);
+    memo[slot].address = address;
+    memo[slot].wallet_idx = (int32_t)idx;
+    return idx;
+}
+
+/* Auflösung über den Interning-Cache der Transaktion: die Direkt-Map
+ * ersetzt das Memo (eltt_add_wallet pflegt sie sofort, das zweite
+ * Auftreten trifft also bereits). Ohne ID (0) bleibt der String-Pfad. */
+static int eltt_apply_resolve_tx(eltt_blockchain *bc,
+                                 eltt_apply_memo_slot *memo,
+                                 uint32_t id, const char *address)
+{
+    if (id) {
+        int idx = (int)bc->id_to_wallet[id];
+        if (idx >= 0) {
+            return idx;
+        }
+        return eltt_add_wallet(bc, address);
+    }
+    return eltt_apply_resolve(bc, memo, address);
+}
+
+static void eltt_apply_delta_add(eltt_apply_delta_slot *deltas,
+                                 int wallet_idx, int token_idx,
+                                 eltt_amount_fp amount)
+{
+    if (wallet_idx < 0) {
+        return;
+    }
+    uint32_t h = (uint32_t)wallet_idx * 2654435761u + (uint32_t)token_idx;
+    uint32_t slot = h & (ELTT_APPLY_DELTA_CAP - 1);
+    while (deltas[slot].wallet_idx >= 0) {
+        if (deltas[slot].wallet_idx == wallet_idx &&
+            deltas[slot].token_idx == token_idx) {
+            deltas[slot].delta = eltt_fp_add_sat(deltas[slot].delta, amount);
+            return;
+        }
+        slot = (slot + 1) & (ELTT_APPLY_DELTA_CAP - 1);
+    }
+    deltas[slot].wallet_idx = (int32_t)wallet_idx;
+    deltas[slot].token_idx = (int32_t)token_idx;
+    deltas[slot].delta = amount;
+}
+
+static void eltt_apply_block_batch(eltt_blockchain *bc, const eltt_block *block)
+{
+    /* Reward-Akkumulatoren einmal pro Block fortschreiben, bevor
+     * Stake/Unstake/Claim gegen sie verrechnet werden. */
+    eltt_stake_accrue(bc, block->timestamp);
+
+    /* Der Apply-Pfad ist per Konstruktion seriell (ein Block nach dem
+     * anderen); die Arbeitspuffer können daher statisch sein. */
+    static eltt_apply_memo_slot memo[ELTT_APPLY_MEMO_CAP];
+    static eltt_apply_delta_slot deltas[ELTT_APPLY_DELTA_CAP];
+    memset(memo, 0, sizeof(memo));
+    for (size_t i = 0; i < ELTT_APPLY_DELTA_CAP; ++i) {
+        deltas[i].wallet_idx = -1;
+    }
+
+    int wallets_touched = 0;
+
+    for (size_t i = 0; i < block->tx_count; ++i) {
+        const eltt_transaction *tx = &block->txs[i];
+        int from_idx = eltt_apply_resolve_tx(bc, memo, tx->from_id, tx->from);
+        int to_idx   = eltt_apply_resolve_tx(bc, memo, tx->to_id, tx->to);
+        eltt_amount_fp amount_fp = eltt_fp_from_double(tx->amount);
+
+        switch (tx->kind) {
+            case ELTT_TX_KIND_TRANSFER:
+            case ELTT_TX_KIND_SWAP:
+                eltt_apply_delta_add(deltas, from_idx, tx->token_index, -amount_fp);
+                eltt_apply_delta_add(deltas, to_idx, tx->token_index, amount_fp);
+                wallets_touched = 1;
+                break;
+            case ELTT_TX_KIND_MINT:
+                eltt_apply_delta_add(deltas, to_idx, tx->token_index, amount_fp);
+                wallets_touched = 1;
+                break;
+            case ELTT_TX_KIND_BURN:
+                eltt_apply_delta_add(deltas, from_idx, tx->token_index, -amount_fp);
+                wallets_touched = 1;
+                break;
+            case ELTT_TX_KIND_STAKE: {
+                int p = eltt_stake_find_position(bc, tx->from, tx->token_index);
+                if (p < 0 && bc->stake_count < ELTT_MAX_STAKES) {
+                    p = (int)bc->stake_count++;
+                    eltt_staking_position *pos = &bc->stakes[p];
+                    memset(pos, 0, sizeof(*pos));
+                    /* tx->from ist ein fixes 64-Byte-Feld */
+                    memcpy(pos->owner, tx->from, ELTT_MAX_ADDRESS_LEN);
+                    pos->owner[ELTT_MAX_ADDRESS_LEN - 1] = '\0';
+                    pos->token_index = tx->token_index;
+                    pos->start_timestamp = block->timestamp;
+                    pos->reward_per_token_snap =
+                        bc->stake_reward_per_token[tx->token_index];
+                }
+                if (p >= 0) {
+                    eltt_staking_position *pos = &bc->stakes[p];
+                    eltt_stake_position_settle(bc, pos);
+                    pos->amount += tx->amount;
+                    eltt_apply_delta_add(deltas, from_idx, tx->token_index,
+                                         -amount_fp);
+                    wallets_touched = 1;
+                }
+                eltt_view_mark(bc, ELTT_VIEW_STAKES);
+                break;
+            }
+            case ELTT_TX_KIND_UNSTAKE: {
+                int p = eltt_stake_find_position(bc, tx->from, tx->token_index);
+                if (p >= 0) {
+                    eltt_staking_position *pos = &bc->stakes[p];
+                    eltt_stake_position_settle(bc, pos);
+                    /* amount == 0 löst die ganze Position auf; sonst wird
+                     * auf den Bestand geklemmt. */
+                    double w = (tx->amount <= 0.0 || tx->amount > pos->amount)
+                                   ? pos->amount : tx->amount;
+                    pos->amount -= w;
+                    eltt_apply_delta_add(deltas, from_idx, tx->token_index,
+                                         eltt_fp_from_double(w));
+                    wallets_touched = 1;
+                }
+                eltt_view_mark(bc, ELTT_VIEW_STAKES);
+                break;
+            }
+            case ELTT_TX_KIND_CLAIM_REWARDS: {
+                int p = eltt_stake_find_position(bc, tx->from, tx->token_index);
+                if (p >= 0) {
+                    eltt_staking_position *pos = &bc->stakes[p];
+                    eltt_stake_position_settle(bc, pos);
+                    eltt_apply_delta_add(deltas, from_idx, tx->token_index,
+                                         eltt_fp_from_double(pos->accumulated_rewards));
+                    pos->accumulated_rewards = 0.0;
+                    wallets_touched = 1;
+                }
+                eltt_view_mark(bc, ELTT_VIEW_STAKES);
+                break;
+            }
+            case ELTT_TX_KIND_CREATE_POOL:
+            case ELTT_TX_KIND_ADD_LIQUIDITY:
+            case ELTT_TX_KIND_REMOVE_LIQUIDITY:
+                for (size_t p = 0; p < bc->pool_count; ++p) {
+                    eltt_view_sync_pool(bc, p);
+                }
+                break;
+            case ELTT_TX_KIND_CREATE_TOKEN:
+            case ELTT_TX_KIND_PROFILE_UPDATE:
+            case ELTT_TX_KIND_GOVERNANCE_PROPOSAL:
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (size_t i = 0; i < ELTT_APPLY_DELTA_CAP; ++i) {
+        if (deltas[i].wallet_idx >= 0 && deltas[i].delta != 0) {
+            eltt_amount_fp *cell =
+                &bc->wallet_balances[deltas[i].token_idx][deltas[i].wallet_idx];
+            *cell = eltt_fp_add_sat(*cell, deltas[i].delta);
+        }
+    }
+    if (wallets_touched) {
+        eltt_view_mark(bc, ELTT_VIEW_WALLETS);
+    }
+}
+
+/* ----------------------------------------------------------
+ * Block-Validierung und Chain-Aufbau
+ * ---------------------------------------------------------- */
+
+/* Reserviert n zusammenhängende Transaktions-Slots in der Arena.
+ * Passt n nicht mehr in den aktuellen Chunk, wird ein neuer begonnen
+ * (n <= ELTT_MAX_TX_PER_BLOCK <= ELTT_TX_CHUNK_CAP ist garantiert).
+ * Gibt NULL bei Kapazitäts-/Allokationsfehler zurück. */
+static eltt_transaction *eltt_tx_arena_alloc(eltt_blockchain *bc, size_t n)
+{
+    if (n == 0) {
+        return NULL;
+    }
+    if (bc->tx_chunk_count == 0 || bc->tx_chunk_used + n > ELTT_TX_CHUNK_CAP) {
+        if (bc->tx_chunk_count >= ELTT_MAX_TX_CHUNKS) {
+            return NULL;
+        }
+        bc->tx_chunks[bc->tx_chunk_count] =
+            (eltt_transaction *)malloc(ELTT_TX_CHUNK_CAP * sizeof(eltt_transaction));
+        if (!bc->tx_chunks[bc->tx_chunk_count]) {
+            return NULL;
+        }
+        bc->tx_chunk_count++;
+        bc->tx_chunk_used = 0;
+    }
+    eltt_transaction *slots = &bc->tx_chunks[bc->tx_chunk_count - 1][bc->tx_chunk_used];
+    bc->tx_chunk_used += n;
+    return slots;
+}
+
+/* Zugriff auf Block i im segmentierten Speicher (O(1)). */
+static eltt_block *eltt_get_block(const eltt_blockchain *bc, size_t i)
+{
+    return &bc->block_chunks[i / ELTT_BLOCKS_PER_CHUNK][i % ELTT_BLOCKS_PER_CHUNK];
+}
+
+/* Stellt sicher, dass für den nächsten Block ein Chunk existiert.
+ * Gibt den Ziel-Slot zurück oder NULL bei Kapazitäts-/Allokationsfehler. */
+static eltt_block *eltt_block_store_next_slot(eltt_blockchain *bc)
+{
+    size_t chunk = bc->block_count / ELTT_BLOCKS_PER_CHUNK;
+    if (chunk >= ELTT_MAX_BLOCK_CHUNKS) {
+        return NULL;
+    }
+    if (!bc->block_chunks[chunk]) {
+        bc->block_chunks[chunk] =
+            (eltt_block *)malloc(ELTT_BLOCKS_PER_CHUNK * sizeof(eltt_block));
+        if (!bc->block_chunks[chunk]) {
+            return NULL;
+        }
+    }
+    return &bc->block_chunks[chunk][bc->block_count % ELTT_BLOCKS_PER_CHUNK];
+}
+
+/* Zustandsfreier Teil der Blockprüfung: Merkle-Commitment und
+ * Header-Hash. Hängt nur vom Block selbst ab und kann deshalb für
+ * mehrere Blöcke parallel laufen (siehe Pipeline-Ingestion). */
+static int eltt_validate_block_hashes(const eltt_block *block)
+{
+    /* Erst das Merkle-Commitment prüfen, dann den Header-Hash über
+     * die (damit verifizierte) Wurzel. */
+    uint8_t expected_root[32];
+    eltt_compute_merkle_root(block->txs, block->tx_count, expected_root);
+    if (memcmp(expected_root, block->merkle_root, 32) != 0) {
+        return 0;
+    }
+
+    uint8_t expected[32];
+    eltt_compute_block_hash_into(block, expected);
+    if (memcmp(expected, block->hash, 32) != 0) {
+        return 0;
+    }
+    return 1;
+}
+
+/* Zustandsabhängiger Teil: Verkettung mit dem Tip und die
+ * Transaktionsprüfung gegen die aktuellen Guthaben. */
+static int eltt_validate_block_linkage(const eltt_blockchain *bc,
+                                       const eltt_block *block)
+{
+    if (block->index == 0) {
+        uint8_t zero[32];
+        memset(zero, 0, 32);
+        if (memcmp(block->prev_hash, zero, 32) != 0) {
+            return 0;
+        }
+    } else {
+        if (bc->block_count == 0) {
+            return 0;
+        }
+        const eltt_block *prev = eltt_get_block(bc, bc->block_count - 1);
+        if (block->index != prev->index + 1) {
+            return 0;
+        }
+        if (memcmp(block->prev_hash, prev->hash, 32) != 0) {
+            return 0;
+        }
+    }
+
+    for (size_t i = 0; i < block->tx_count; ++i) {
+        if (!eltt_validate_transaction(bc, &block->txs[i])) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static int eltt_validate_block_impl(const eltt_blockchain *bc, const eltt_block *block)
+{
+    return eltt_validate_block_linkage(bc, block) &&
+           eltt_validate_block_hashes(block);
+}
+
+/* Zähl- und Zeitmess-Hülle um die eigentliche Blockprüfung. */
+static int eltt_validate_block(const eltt_blockchain *bc, const eltt_block *block)
+{
+    uint64_t t0 = eltt_stats_now_ns();
+    int ok = eltt_validate_block_impl(bc, block);
+    eltt_stats_hist_record(eltt_stats_state.validate_ns_hist,
+                           eltt_stats_now_ns() - t0);
+    eltt_stats_add(&eltt_stats_state.block_validations, 1);
+    return ok;
+}
+
+/* Stellt einen Block in den Block-Speicher ein (Arena-Kopie der
+ * Transaktionen, Interning-Cache gefüllt), ohne ihn zu zählen oder
+ * anzuwenden. Die Validierung läuft anschließend über die Kopie —
+ * und damit komplett über Integer-IDs. Gibt den Slot zurück oder
+ * NULL bei Kapazitäts-/Allokationsfehler. */
+static eltt_block *eltt_stage_block(eltt_blockchain *bc, const eltt_block *block)
+{
+    eltt_block *slot = eltt_block_store_next_slot(bc);
+    if (!slot) {
+        return NULL;
+    }
+    *slot = *block;
+    if (block->tx_count > 0) {
+        eltt_transaction *arena_txs = eltt_tx_arena_alloc(bc, block->tx_count);
+        if (!arena_txs) {
+            return NULL;
+        }
+        memcpy(arena_txs, block->txs, block->tx_count * sizeof(eltt_transaction));
+        slot->txs = arena_txs;
+    } else {
+        slot->txs = NULL;
+    }
+    eltt_block_intern_ids(slot);
+    return slot;
+}
+
+/* Nimmt die Arena-Reservierung eines eingestellten, aber abgelehnten
+ * Blocks zurück (die Slots lagen am Ende des aktuellen Chunks). */
+static void eltt_unstage_block(eltt_blockchain *bc, const eltt_block *slot)
+{
+    bc->tx_chunk_used -= slot->tx_count;
+}
+
+/* Übernimmt einen eingestellten, geprüften Block endgültig: zählen,
+ * Chain-Generation, Batch-Anwendung, Aktivitäts-Index. */
+static void eltt_commit_staged_block(eltt_blockchain *bc, eltt_block *slot)
+{
+    bc->block_count++;
+    eltt_view_mark(bc, ELTT_VIEW_CHAIN);
+
+    eltt_apply_block_batch(bc, slot);
+
+    /* Erst nach dem Anwenden indizieren: dann existieren auch Wallets,
+     * die dieser Block neu angelegt hat. */
+    eltt_activity_index_block(bc, slot);
+    eltt_bloom_index_block(bc, slot);
+}
+
+static int eltt_append_block_impl(eltt_blockchain *bc, const eltt_block *block)
+{
+    eltt_block *slot = eltt_stage_block(bc, block);
+    if (!slot) {
+        return 0;
+    }
+    if (!eltt_validate_block(bc, slot)) {
+        eltt_unstage_block(bc, slot);
+        return 0;
+    }
+    eltt_commit_staged_block(bc, slot);
+    return 1;
+}
+
+static int eltt_append_block(eltt_blockchain *bc, const eltt_block *block)
+{
+    uint64_t t0 = eltt_stats_now_ns();
+    int ok = eltt_append_block_impl(bc, block);
+    eltt_stats_hist_record(eltt_stats_state.append_ns_hist,
+                           eltt_stats_now_ns() - t0);
+    if (ok) {
+        eltt_stats_add(&eltt_stats_state.blocks_appended, 1);
+        eltt_stats_add(&eltt_stats_state.txs_applied, block->tx_count);
+    } else {
+        eltt_stats_add(&eltt_stats_state.blocks_rejected, 1);
+    }
+    return ok;
+}
+
+/* ----------------------------------------------------------
+ * Fork-Views: Copy-on-Write-Overlay für Kandidaten-Blöcke
+ *
+ * Konkurrieren zwei Kandidaten-Blöcke um dieselbe Höhe, musste bisher
+ * die gesamte Blockchain (mehrere MB statischer Arrays) kopiert
+ * werden, weil das Anwenden in-place mutiert. Ein Fork-View legt sich
+ * stattdessen als dünnes Overlay über eine Basis: er merkt sich nur
+ * die Guthaben-Zellen, die ein Kandidat berührt, und die Adressen, die
+ * er neu anlegen würde. Lesezugriffe fallen auf die Basis durch,
+ * Schreibzugriffe landen im Overlay. Am Ende wird das Delta entweder
+ * in die Basis übernommen oder der View einfach verworfen.
+ *
+ * Die Basis wird ausschließlich gelesen; mehrere Fork-Views können
+ * deshalb in parallelen Threads auf derselben Basis rechnen, solange
+ * zwischen Init und Commit niemand an die Basis anhängt (der Commit
+ * prüft das). Die Struktur ist einige zehn KB groß — wie die
+ * Blockchain selbst nicht auf dem Stack anlegen.
+ * ---------------------------------------------------------- */
+
+/* Zweierpotenz, > 2 * 2 * ELTT_MAX_TX_PER_BLOCK Guthaben-Zellen. */
+#define ELTT_FORK_BALANCE_CAP 4096
+/* Neue Wallets über alle angewendeten Kandidaten-Blöcke hinweg. */
+#define ELTT_FORK_MAX_NEW_WALLETS 1024
+/* Blöcke, die ein View stapeln kann, bevor committet werden muss. */
+#define ELTT_FORK_MAX_BLOCKS 8
+
+typedef struct {
+    int32_t wallet_idx;   /* -1 = leer */
+    int32_t token_idx;
+    eltt_amount_fp value; /* absoluter Overlay-Wert, nicht Delta */
+} eltt_fork_balance_slot;
+
+typedef struct {
+    const eltt_blockchain *base;
+    size_t base_block_count;   /* Basis-Stand bei Init (Commit-Prüfung) */
+    size_t base_wallet_count;
+
+    /* Tip aus Sicht des Views (Basis-Tip oder letzter gestapelter Block) */
+    uint32_t tip_index;
+    uint8_t  tip_hash[32];
+    int      has_tip;
+
+    /* Adressen, die der Kandidat neu anlegt; Overlay-Index der j-ten
+     * Adresse ist base_wallet_count + j. */
+    size_t new_wallet_count;
+    char   new_wallets[ELTT_FORK_MAX_NEW_WALLETS][ELTT_MAX_ADDRESS_LEN];
+
+    eltt_fork_balance_slot balances[ELTT_FORK_BALANCE_CAP];
+
+    /* Angewendete Blöcke (Zeiger des Aufrufers; müssen bis Commit oder
+     * Verwerfen gültig bleiben). */
+    size_t applied_count;
+    const eltt_block *applied[ELTT_FORK_MAX_BLOCKS];
+} eltt_fork_view;
+
+void eltt_fork_view_init(eltt_fork_view *fv, const eltt_blockchain *base)
+{
+    fv->base = base;
+    fv->base_block_count = base->block_count;
+    fv->base_wallet_count = base->wallet_count;
+    fv->has_tip = base->block_count > 0;
+    if (fv->has_tip) {
+        const eltt_block *tip = eltt_get_block(base, base->block_count - 1);
+        fv->tip_index = tip->index;
+        memcpy(fv->tip_hash, tip->hash, 32);
+    }
+    fv->new_wallet_count = 0;
+    for (size_t i = 0; i < ELTT_FORK_BALANCE_CAP; ++i) {
+        fv->balances[i].wallet_idx = -1;
+    }
+    fv->applied_count = 0;
+}
+
+/* Wallet-Index aus Sicht des Views: erst die Basis, dann die im
+ * Overlay neu angelegten Adressen. -1, wenn unbekannt. */
+static int eltt_fork_find_wallet(const eltt_fork_view *fv, const char *address)
+{
+    int idx = eltt_find_wallet_index(fv->base, address);
+    if (idx >= 0) {
+        return idx;
+    }
+    for (size_t j = 0; j < fv->new_wallet_count; ++j) {
+        if (strcmp(fv->new_wallets[j], address) == 0) {
+            return (int)(fv->base_wallet_count + j);
+        }
+    }
+    return -1;
+}
+
+static int eltt_fork_add_wallet(eltt_fork_view *fv, const char *address)
+{
+    if (fv->base_wallet_count + fv->new_wallet_count >= ELTT_MAX_WALLETS ||
+        fv->new_wallet_count >= ELTT_FORK_MAX_NEW_WALLETS) {
+        return -1;
+    }
+    size_t j = fv->new_wallet_count;
+    /* address zeigt in die from/to-Felder eines Blocks (feste
+     * 64-Byte-Arrays), die Länge ist also bereits begrenzt. */
+    memcpy(fv->new_wallets[j], address, ELTT_MAX_ADDRESS_LEN);
+    fv->new_wallets[j][ELTT_MAX_ADDRESS_LEN - 1] = '\0';
+    fv->new_wallet_count++;
+    return (int)(fv->base_wallet_count + j);
+}
+
+static eltt_fork_balance_slot *eltt_fork_balance_slot_for(eltt_fork_view *fv,
+                                                          int wallet_idx,
+                                                          int token_idx)
+{
+    uint32_t h = (uint32_t)wallet_idx * 2654435761u + (uint32_t)token_idx;
+    uint32_t slot = h & (ELTT_FORK_BALANCE_CAP - 1);
+    while (fv->balances[slot].wallet_idx >= 0) {
+        if (fv->balances[slot].wallet_idx == wallet_idx &&
+            fv->balances[slot].token_idx == token_idx) {
+            return &fv->balances[slot];
+        }
+        slot = (slot + 1) & (ELTT_FORK_BALANCE_CAP - 1);
+    }
+    return &fv->balances[slot];
+}
+
+/* Effektives Guthaben: Overlay-Zelle, sonst Basis, sonst 0 (neue Wallet). */
+static eltt_amount_fp eltt_fork_get_balance(const eltt_fork_view *fv,
+                                            int wallet_idx, int token_idx)
+{
+    eltt_fork_balance_slot *s =
+        eltt_fork_balance_slot_for((eltt_fork_view *)fv, wallet_idx, token_idx);
+    if (s->wallet_idx >= 0) {
+        return s->value;
+    }
+    if ((size_t)wallet_idx < fv->base_wallet_count) {
+        return fv->base->wallet_balances[token_idx][wallet_idx];
+    }
+    return 0;
+}
+
+static void eltt_fork_balance_add(eltt_fork_view *fv,
+                                  int wallet_idx, int token_idx,
+                                  eltt_amount_fp amount)
+{
+    if (wallet_idx < 0) {
+        return;
+    }
+    eltt_fork_balance_slot *s =
+        eltt_fork_balance_slot_for(fv, wallet_idx, token_idx);
+    if (s->wallet_idx < 0) {
+        s->wallet_idx = (int32_t)wallet_idx;
+        s->token_idx = (int32_t)token_idx;
+        s->value = ((size_t)wallet_idx < fv->base_wallet_count)
+                       ? fv->base->wallet_balances[token_idx][wallet_idx]
+                       : 0;
+    }
+    s->value = eltt_fp_add_sat(s->value, amount);
+}
+
+/* Transaktionsprüfung gegen den Overlay-Zustand; Spiegel von
+ * eltt_validate_transaction mit Guthaben aus Sicht des Views. */
+static int eltt_fork_validate_transaction(const eltt_fork_view *fv,
+                                          const eltt_transaction *tx)
+{
+    if (tx->token_index < 0 || (size_t)tx->token_index >= fv->base->token_count) {
+        return 0;
+    }
+    if (tx->amount < 0.0) {
+        return 0;
+    }
+
+    int from_idx = eltt_fork_find_wallet(fv, tx->from);
+    int to_idx   = eltt_fork_find_wallet(fv, tx->to);
+    eltt_amount_fp amount_fp = eltt_fp_from_double(tx->amount);
+
+    switch (tx->kind) {
+        case ELTT_TX_KIND_TRANSFER:
+        case ELTT_TX_KIND_SWAP:
+            if (from_idx < 0) return 0;
+            if (eltt_fork_get_balance(fv, from_idx, tx->token_index) < amount_fp) return 0;
+            if (amount_fp <= 0) return 0;
+            break;
+        /* Das Overlay modelliert keine Staking-Positionen: ein über den
+         * Fork committeter STAKE würde den Einsatz binden, ohne je eine
+         * Position anzulegen, UNSTAKE/CLAIM würden Rückzahlung bzw.
+         * Reward verlieren — der Zustand wiche von eltt_append_block
+         * und vom Restore-Replay derselben Chain-Datei ab. Solche
+         * Blöcke müssen über den regulären Append-Pfad laufen. */
+        case ELTT_TX_KIND_STAKE:
+        case ELTT_TX_KIND_UNSTAKE:
+        case ELTT_TX_KIND_CLAIM_REWARDS:
+            return 0;
+        case ELTT_TX_KIND_MINT:
+            if (to_idx < 0) return 0;
+            if (amount_fp <= 0) return 0;
+            break;
+        case ELTT_TX_KIND_BURN:
+            if (from_idx < 0) return 0;
+            if (eltt_fork_get_balance(fv, from_idx, tx->token_index) < amount_fp) return 0;
+            if (amount_fp <= 0) return 0;
+            break;
+        case ELTT_TX_KIND_CREATE_TOKEN:
+        case ELTT_TX_KIND_CREATE_POOL:
+        case ELTT_TX_KIND_ADD_LIQUIDITY:
+        case ELTT_TX_KIND_REMOVE_LIQUIDITY:
+        case ELTT_TX_KIND_PROFILE_UPDATE:
+        case ELTT_TX_KIND_GOVERNANCE_PROPOSAL:
+            break;
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+/* Blockprüfung aus Sicht des Views: Hashes wie gehabt, Verkettung
+ * gegen den View-Tip, Transaktionen gegen den Overlay-Zustand. */
+int eltt_fork_validate_block(const eltt_fork_view *fv, const eltt_block *block)
+{
+    if (!fv->has_tip) {
+        uint8_t zero[32];
+        memset(zero, 0, 32);
+        if (block->index != 0 || memcmp(block->prev_hash, zero, 32) != 0) {
+            return 0;
+        }
+    } else {
+        if (block->index != fv->tip_index + 1) {
+            return 0;
+        }
+        if (memcmp(block->prev_hash, fv->tip_hash, 32) != 0) {
+            return 0;
+        }
+    }
+
+    for (size_t i = 0; i < block->tx_count; ++i) {
+        if (!eltt_fork_validate_transaction(fv, &block->txs[i])) {
+            return 0;
+        }
+    }
+
+    return eltt_validate_block_hashes(block);
+}
+
+/* Wendet einen geprüften Kandidaten-Block auf das Overlay an. Wallet-
+ * Anlage in Erst-Auftretens-Reihenfolge und additive Guthaben-Updates
+ * spiegeln eltt_apply_block_batch; nur landet alles im Overlay. Der
+ * Block-Zeiger wird für den Commit gemerkt und muss bis dahin gültig
+ * bleiben. */
+int eltt_fork_apply_block(eltt_fork_view *fv, const eltt_block *block)
+{
+    if (fv->applied_count >= ELTT_FORK_MAX_BLOCKS) {
+        return 0;
+    }
+    if (!eltt_fork_validate_block(fv, block)) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < block->tx_count; ++i) {
+        const eltt_transaction *tx = &block->txs[i];
+        int from_idx = eltt_fork_find_wallet(fv, tx->from);
+        if (from_idx < 0) {
+            from_idx = eltt_fork_add_wallet(fv, tx->from);
+        }
+        int to_idx = eltt_fork_find_wallet(fv, tx->to);
+        if (to_idx < 0) {
+            to_idx = eltt_fork_add_wallet(fv, tx->to);
+        }
+
+        eltt_amount_fp amount_fp = eltt_fp_from_double(tx->amount);
+        switch (tx->kind) {
+            case ELTT_TX_KIND_TRANSFER:
+            case ELTT_TX_KIND_SWAP:
+                eltt_fork_balance_add(fv, from_idx, tx->token_index, -amount_fp);
+                eltt_fork_balance_add(fv, to_idx, tx->token_index, amount_fp);
+                break;
+            /* STAKE/UNSTAKE/CLAIM werden von der View-Validierung
+             * abgelehnt (keine Positions-Modellierung im Overlay) und
+             * tauchen hier nicht auf. */
+            case ELTT_TX_KIND_MINT:
+                eltt_fork_balance_add(fv, to_idx, tx->token_index, amount_fp);
+                break;
+            case ELTT_TX_KIND_BURN:
+                eltt_fork_balance_add(fv, from_idx, tx->token_index, -amount_fp);
+                break;
+            default:
+                break;
+        }
+    }
+
+    fv->tip_index = block->index;
+    memcpy(fv->tip_hash, block->hash, 32);
+    fv->has_tip = 1;
+    fv->applied[fv->applied_count++] = block;
+    return 1;
+}
+
+/* Übernimmt das Overlay in die Basis: neue Wallets in Overlay-
+ * Reihenfolge (Indizes bleiben dadurch identisch), dann die berührten
+ * Guthaben-Zellen, dann die gestapelten Blöcke in den Block-Speicher.
+ * Schlägt fehl, wenn die Basis sich seit Init verändert hat — dann
+ * wäre das Delta gegen einen veralteten Stand gerechnet. Alle
+ * Kapazitäts- und Allokationsfehler werden vor der ersten sichtbaren
+ * Mutation abgefangen: ein fehlgeschlagener Commit lässt die Basis
+ * unverändert zurück (gleiche Messlatte wie das Unstagen im
+ * Append-Pfad). */
+int eltt_fork_commit(eltt_blockchain *bc, eltt_fork_view *fv)
+{
+    if (bc != fv->base ||
+        bc->block_count != fv->base_block_count ||
+        bc->wallet_count != fv->base_wallet_count) {
+        return 0;
+    }
+    if (bc->wallet_count + fv->new_wallet_count > ELTT_MAX_WALLETS) {
+        return 0;
+    }
+
+    /* Reservierungsphase: Block-Slots und Arena-Speicher für alle
+     * gestapelten Blöcke beschaffen, BEVOR irgendetwas Sichtbares
+     * mutiert wird. Schlägt hier etwas fehl (Chunk-Verzeichnis voll,
+     * malloc), kehren wir zurück, ohne Guthaben oder Zähler angefasst
+     * zu haben — höchstens vorab allokierte Chunks bzw. verworfener
+     * Arena-Platz bleiben übrig, beides ohne sichtbare Wirkung. */
+    eltt_block *slots[ELTT_FORK_MAX_BLOCKS];
+    eltt_transaction *slot_txs[ELTT_FORK_MAX_BLOCKS];
+    for (size_t b = 0; b < fv->applied_count; ++b) {
+        size_t idx = fv->base_block_count + b;
+        size_t chunk = idx / ELTT_BLOCKS_PER_CHUNK;
+        if (chunk >= ELTT_MAX_BLOCK_CHUNKS) {
+            return 0;
+        }
+        if (!bc->block_chunks[chunk]) {
+            bc->block_chunks[chunk] =
+                (eltt_block *)malloc(ELTT_BLOCKS_PER_CHUNK * sizeof(eltt_block));
+            if (!bc->block_chunks[chunk]) {
+                return 0;
+            }
+        }
+        slots[b] = &bc->block_chunks[chunk][idx % ELTT_BLOCKS_PER_CHUNK];
+        if (fv->applied[b]->tx_count > 0) {
+            slot_txs[b] = eltt_tx_arena_alloc(bc, fv->applied[b]->tx_count);
+            if (!slot_txs[b]) {
+                return 0;
+            }
+        } else {
+            slot_txs[b] = NULL;
+        }
+    }
+
+    /* Ab hier kann nichts mehr fehlschlagen (die Wallet-Kapazität ist
+     * vorab geprüft; der Rückgabewert-Check bleibt rein defensiv). */
+    for (size_t j = 0; j < fv->new_wallet_count; ++j) {
+        if (eltt_add_wallet(bc, fv->new_wallets[j]) !=
+            (int)(fv->base_wallet_count + j)) {
+            return 0;
+        }
+    }
+
+    int wallets_touched = 0;
+    for (size_t i = 0; i < ELTT_FORK_BALANCE_CAP; ++i) {
+        const eltt_fork_balance_slot *s = &fv->balances[i];
+        if (s->wallet_idx >= 0) {
+            bc->wallet_balances[s->token_idx][s->wallet_idx] = s->value;
+            wallets_touched = 1;
+        }
+    }
+    if (wallets_touched) {
+        eltt_view_mark(bc, ELTT_VIEW_WALLETS);
+    }
+
+    for (size_t b = 0; b < fv->applied_count; ++b) {
+        const eltt_block *block = fv->applied[b];
+        eltt_block *slot = slots[b];
+        *slot = *block;
+        if (block->tx_count > 0) {
+            memcpy(slot_txs[b], block->txs,
+                   block->tx_count * sizeof(eltt_transaction));
+        }
+        slot->txs = slot_txs[b];
+        eltt_block_intern_ids(slot);
+        bc->block_count++;
+        eltt_view_mark(bc, ELTT_VIEW_CHAIN);
+        eltt_activity_index_block(bc, slot);
+        eltt_bloom_index_block(bc, slot);
+        eltt_stats_add(&eltt_stats_state.blocks_appended, 1);
+        eltt_stats_add(&eltt_stats_state.txs_applied, block->tx_count);
+    }
+
+    return 1;
+}
+
+/* Verwirft das Overlay und setzt den View frisch auf die Basis auf.
+ * Beim Verwerfen fällt keinerlei Rückbau an — das ist der Witz der
+ * Overlay-Konstruktion. */
+void eltt_fork_discard(eltt_fork_view *fv)
+{
+    eltt_fork_view_init(fv, fv->base);
+}
+
+/* ----------------------------------------------------------
+ * Mempool (MPSC-Ring) und Block-Assemblierung
+ *
+ * Gebundener lock-freier Ring für eingehende Transaktionen: viele
+ * Producer (Ingestion-Verbindungen), ein Consumer (Block-Builder).
+ * Jeder Slot trägt eine Sequenznummer; Producer reservieren per CAS
+ * auf head, publizieren mit einem Release-Store der Sequenz, der
+ * Consumer liest mit Acquire — keine Mutexe, kein Spinlock.
+ *
+ * Aufnahme validiert gegen den aktuellen Chain-Zustand (beratend:
+ * der Zustand kann sich bis zum Versiegeln ändern; die verbindliche
+ * Prüfung läuft wie immer in eltt_append_block()).
+ * ---------------------------------------------------------- */
+
+#define ELTT_MEMPOOL_CAP 4096 /* Zweierpotenz */
+
+typedef struct {
+    _Atomic uint64_t seq;
+    eltt_transaction tx;
+} eltt_mempool_slot;
+
+typedef struct {
+    _Atomic uint64_t head; /* Producer reservieren hier */
+    _Atomic uint64_t tail; /* nur der eine Consumer schreibt hier */
+    eltt_mempool_slot slots[ELTT_MEMPOOL_CAP];
+} eltt_mempool;
+
+void eltt_mempool_init(eltt_mempool *mp)
+{
+    atomic_store_explicit(&mp->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&mp->tail, 0, memory_order_relaxed);
+    for (size_t i = 0; i < ELTT_MEMPOOL_CAP; ++i) {
+        atomic_store_explicit(&mp->slots[i].seq, (uint64_t)i,
+                              memory_order_relaxed);
+    }
+}
+
+/* Nimmt eine Transaktion auf (beliebig viele Threads). Gibt 1 zurück,
+ * 0 bei vollem Ring oder wenn die Transaktion gegen den übergebenen
+ * Zustand nicht validiert (bc darf NULL sein: dann ohne Vorprüfung). */
+int eltt_mempool_push(eltt_mempool *mp, const eltt_blockchain *bc,
+                      const eltt_transaction *tx)
+{
+    /* Producer-Puffer können uninitialisierte Interning-IDs tragen;
+     * an der Grenze werden sie verworfen (vergeben wird erst bei der
+     * Arena-Kopie im Append-Pfad). */
+    eltt_transaction clean = *tx;
+    clean.from_id = 0;
+    clean.to_id = 0;
+    if (bc && !eltt_validate_transaction(bc, &clean)) {
+        return 0;
+    }
+    uint64_t pos = atomic_load_explicit(&mp->head, memory_order_relaxed);
+    for (;;) {
+        eltt_mempool_slot *s = &mp->slots[pos & (ELTT_MEMPOOL_CAP - 1)];
+        uint64_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+        int64_t diff = (int64_t)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &mp->head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                s->tx = clean;
+                atomic_store_explicit(&s->seq, pos + 1, memory_order_release);
+                return 1;
+            }
+        } else if (diff < 0) {
+            return 0; /* Ring voll */
+        } else {
+            pos = atomic_load_explicit(&mp->head, memory_order_relaxed);
+        }
+    }
+}
+
+/* Entnimmt die älteste Transaktion (nur der eine Consumer). */
+int eltt_mempool_pop(eltt_mempool *mp, eltt_transaction *out)
+{
+    uint64_t pos = atomic_load_explicit(&mp->tail, memory_order_relaxed);
+    eltt_mempool_slot *s = &mp->slots[pos & (ELTT_MEMPOOL_CAP - 1)];
+    uint64_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+    if ((int64_t)(seq - (pos + 1)) < 0) {
+        return 0; /* leer */
+    }
+    *out = s->tx;
+    atomic_store_explicit(&s->seq, pos + ELTT_MEMPOOL_CAP,
+                          memory_order_release);
+    atomic_store_explicit(&mp->tail, pos + 1, memory_order_relaxed);
+    return 1;
+}
+
+/* Ungefährer Füllstand (rennt naturgemäß gegen die Producer). */
+size_t eltt_mempool_count(const eltt_mempool *mp)
+{
+    uint64_t head = atomic_load_explicit(&mp->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&mp->tail, memory_order_relaxed);
+    return (head > tail) ? (size_t)(head - tail) : 0;
+}
+
+/* Entleert bis zu ELTT_MAX_TX_PER_BLOCK Transaktionen aus dem
+ * Mempool in tx_buf (vom Aufrufer gestellt), dedupliziert inhaltlich
+ * und versiegelt einen anhängbaren Block (Index/prev_hash vom Tip,
+ * Merkle-Wurzel und Header-Hash berechnet). Gibt die Zahl der
+ * aufgenommenen Transaktionen zurück; 0, wenn nichts zu bauen war
+ * oder noch kein Genesis-Block existiert. */
+size_t eltt_blockchain_build_block_from_mempool(const eltt_blockchain *bc,
+                                                eltt_mempool *mp,
+                                                uint64_t timestamp,
+                                                eltt_transaction *tx_buf,
+                                                eltt_block *out_block)
+{
+    if (bc->block_count == 0) {
+        return 0;
+    }
+    uint64_t keys[ELTT_MAX_TX_PER_BLOCK];
+    size_t n = 0;
+    eltt_transaction tx;
+    while (n < ELTT_MAX_TX_PER_BLOCK && eltt_mempool_pop(mp, &tx)) {
+        uint64_t key = eltt_transaction_content_key(&tx);
+        int duplicate = 0;
+        for (size_t i = 0; i < n; ++i) {
+            /* Schlüsselvergleich als Filter, Inhalt entscheidet. */
+            if (keys[i] == key &&
+                strcmp(tx_buf[i].from, tx.from) == 0 &&
+                strcmp(tx_buf[i].to, tx.to) == 0 &&
+                tx_buf[i].amount == tx.amount &&
+                tx_buf[i].token_index == tx.token_index &&
+                tx_buf[i].kind == tx.kind &&
+                strcmp(tx_buf[i].memo, tx.memo) == 0) {
+                duplicate = 1;
+                break;
+            }
+        }
+        if (duplicate) {
+            continue;
+        }
+        keys[n] = key;
+        tx_buf[n] = tx;
+        n++;
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    const eltt_block *tip = eltt_get_block(bc, bc->block_count - 1);
+    memset(out_block, 0, sizeof(*out_block));
+    out_block->index = tip->index + 1;
+    out_block->timestamp = timestamp;
+    memcpy(out_block->prev_hash, tip->hash, 32);
+    out_block->tx_count = n;
+    out_block->txs = tx_buf;
+    eltt_compute_block_hash(out_block);
+    return n;
+}
+
+/* ----------------------------------------------------------
+ * Pipeline-Ingestion (Bulk-Sync / Chain-Replay)
+ *
+ * eltt_append_block() prüft und wendet strikt seriell an; beim
+ * Replay langer Ketten bleibt dabei ein Kern ausgelastet. Hier
+ * überlappen die Phasen: Worker-Threads rechnen die zustandsfreien
+ * Hash-Prüfungen (Merkle-Wurzel + Header-Hash) für alle Blöcke
+ * parallel voraus, während der aufrufende Thread in Block-Reihenfolge
+ * Verkettung und Transaktionsprüfung erledigt und anwendet — die
+ * prev_hash-Verkettung ist der einzige Serialisierungspunkt.
+ * ---------------------------------------------------------- */
+
+#include <pthread.h>
+#include <sched.h>
+
+#define ELTT_PIPELINE_MAX_WORKERS 8
+
+typedef struct {
+    const eltt_block *blocks;
+    size_t n;
+    size_t start;
+    size_t stride;
+    /* 0 = ausstehend, 1 = Hashes ok, 2 = Hashes fehlerhaft */
+    _Atomic uint8_t *hash_state;
+} eltt_pipeline_worker_ctx;
+
+static void *eltt_pipeline_hash_worker(void *arg)
+{
+    eltt_pipeline_worker_ctx *ctx = (eltt_pipeline_worker_ctx *)arg;
+    for (size_t i = ctx->start; i < ctx->n; i += ctx->stride) {
+        uint8_t state = eltt_validate_block_hashes(&ctx->blocks[i]) ? 1 : 2;
+        atomic_store_explicit(&ctx->hash_state[i], state,
+                              memory_order_release);
+    }
+    return NULL;
+}
+
+/* Hängt blocks[0..n) in Reihenfolge an; Hash-Verifikation läuft auf
+ * num_threads Workern parallel zur seriellen Anwendung. Gibt die Zahl
+ * der übernommenen Blöcke zurück (stoppt am ersten ungültigen). */
+size_t eltt_blockchain_add_blocks_pipelined(eltt_blockchain *bc,
+                                            const eltt_block *blocks,
+                                            size_t n, size_t num_threads)
+{
+    if (n == 0) {
+        return 0;
+    }
+    if (num_threads < 2 || n < 4) {
+        /* Pipeline lohnt nicht: normaler serieller Pfad. */
+        size_t appended = 0;
+        while (appended < n && eltt_append_block(bc, &blocks[appended])) {
+            appended++;
+        }
+        return appended;
+    }
+    if (num_threads > ELTT_PIPELINE_MAX_WORKERS) {
+        num_threads = ELTT_PIPELINE_MAX_WORKERS;
+    }
+
+    _Atomic uint8_t *hash_state =
+        (_Atomic uint8_t *)calloc(n, sizeof(_Atomic uint8_t));
+    if (!hash_state) {
+        size_t appended = 0;
+        while (appended < n && eltt_append_block(bc, &blocks[appended])) {
+            appended++;
+        }
+        return appended;
+    }
+
+    pthread_t workers[ELTT_PIPELINE_MAX_WORKERS];
+    eltt_pipeline_worker_ctx ctxs[ELTT_PIPELINE_MAX_WORKERS];
+    size_t started = 0;
+    for (size_t w = 0; w < num_threads; ++w) {
+        ctxs[w].blocks = blocks;
+        ctxs[w].n = n;
+        ctxs[w].start = w;
+        ctxs[w].stride = num_threads;
+        ctxs[w].hash_state = hash_state;
+        if (pthread_create(&workers[w], NULL,
+                           eltt_pipeline_hash_worker, &ctxs[w]) != 0) {
+            break;
+        }
+        started++;
+    }
+    if (started == 0) {
+        free(hash_state);
+        size_t appended = 0;
+        while (appended < n && eltt_append_block(bc, &blocks[appended])) {
+            appended++;
+        }
+        return appended;
+    }
+    if (started < num_threads) {
+        /* Liegengebliebene Streifen selbst hashen. */
+        for (size_t w = started; w < num_threads; ++w) {
+            eltt_pipeline_hash_worker(&ctxs[w]);
+        }
+    }
+
+    size_t appended = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint8_t state;
+        while ((state = atomic_load_explicit(&hash_state[i],
+                                             memory_order_acquire)) == 0) {
+            sched_yield();
+        }
+        if (state != 1) {
+            break;
+        }
+        eltt_block *slot = eltt_stage_block(bc, &blocks[i]);
+        if (!slot) {
+            break;
+        }
+        if (!eltt_validate_block_linkage(bc, slot)) {
+            eltt_unstage_block(bc, slot);
+            break;
+        }
+        eltt_commit_staged_block(bc, slot);
+        eltt_stats_add(&eltt_stats_state.blocks_appended, 1);
+        eltt_stats_add(&eltt_stats_state.txs_applied, blocks[i].tx_count);
+        appended++;
+    }
+    if (appended < n) {
+        eltt_stats_add(&eltt_stats_state.blocks_rejected, 1);
+    }
+
+    for (size_t w = 0; w < started; ++w) {
+        pthread_join(workers[w], NULL);
+    }
+    free(hash_state);
+    return appended;
+}
+
+/* ----------------------------------------------------------
+ * Genesis-Block-Logik (ohne Owner-Hardcoding)
+ * ---------------------------------------------------------- */
+
+static void eltt_init_blockchain(eltt_blockchain *bc)
+{
+    memset(bc, 0, sizeof(*bc));
+    bc->block_count = 0;
+    bc->wallet_count = 0;
+    bc->token_count = 0;
+    bc->pool_count = 0;
+    bc->stake_count = 0;
+    eltt_wallet_index_reset(bc);
+
+    eltt_add_token_type(bc, "TTTC", "TTTC", 8, ELTT_TOKEN_KIND_TTTC, 0.75);
+    eltt_add_token_type(bc, "ELTT", "ELTT", 8, ELTT_TOKEN_KIND_ELTT, 0.75);
+    eltt_add_token_type(bc, "ELTC", "ELTC", 8, ELTT_TOKEN_KIND_ELTC, 0.75);
+}
+
+static void eltt_build_genesis_block(eltt_block *genesis,
+                                     const char *owner_address,
+                                     uint64_t timestamp)
+{
+    memset(genesis, 0, sizeof(*genesis));
+    genesis->index = 0;
+    genesis->timestamp = timestamp;
+    memset(genesis->prev_hash, 0, 32);
+    genesis->tx_count = 0;
+    genesis->txs = NULL;
+
+    eltt_compute_block_hash(genesis);
+}
+
+/* ----------------------------------------------------------
+ * Persistenz: binäres Chain-File (mmap-freundlich)
+ *
+ * Append-only-Format mit fester Satzstruktur statt JSON-Replay:
+ *   [eltt_chain_file_header]
+ *   je Block: [eltt_chain_file_record][tx_count * eltt_transaction]
+ *
+ * Der Header trägt als Tail-Prüfsumme ein SHA-256 über die Datei-
+ * Bytes des letzten Satzes (Record + Transaktionen). Beim Laden wird
+ * die Datei read-only gemappt, der Header geprüft und nur die
+ * Tail-Prüfsumme sowie der Header-Hash des letzten Blocks
+ * nachgerechnet — statt jeden Block neu zu parsen und zu hashen.
+ * Die Sätze werden anschließend in den segmentierten Speicher
+ * kopiert (gespeicherte Blöcke zeigen in die Transaktions-Arena,
+ * die Datei kann daher nicht direkt als Block-Speicher dienen).
+ * Das Format ist host-nativ (Endianness/Strukturlayout) und als
+ * lokaler Cache gedacht, nicht als Austauschformat.
+ * ---------------------------------------------------------- */
+
+#define ELTT_CHAIN_FILE_MAGIC   "ELTTCHN1"
+/* Version 2: Merkle-Wurzel im Block-Satz.
+ * Version 3: Transaktionssätze tragen die Interning-ID-Felder mit
+ * (Inhalt ist host-lokal und wird beim Laden neu vergeben). */
+#define ELTT_CHAIN_FILE_VERSION 3u
+
+/* Weiter unten definierte öffentliche API, hier für das Aufräumen
+ * nach fehlgeschlagenem Laden benötigt. */
+void eltt_blockchain_free(eltt_blockchain *bc);
+
+typedef struct {
+    char     magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t block_count;
+    /* SHA-256 über die Datei-Bytes des letzten Satzes
+     * (Record + Transaktionen); Tail-Prüfsumme beim Laden. */
+    uint8_t  tail_checksum[32];
+} eltt_chain_file_header;
+
+typedef struct {
+    uint32_t index;
+    uint32_t tx_count;
+    uint64_t timestamp;
+    uint8_t  prev_hash[32];
+    uint8_t  hash[32];
+    uint8_t  merkle_root[32];
+} eltt_chain_file_record;
+
+static void eltt_chain_file_record_from_block(const eltt_block *block,
+                                              eltt_chain_file_record *rec)
+{
+    memset(rec, 0, sizeof(*rec));
+    rec->index = block->index;
+    rec->tx_count = (uint32_t)block->tx_count;
+    rec->timestamp = block->timestamp;
+    memcpy(rec->prev_hash, block->prev_hash, 32);
+    memcpy(rec->hash, block->hash, 32);
+    memcpy(rec->merkle_root, block->merkle_root, 32);
+}
+
+/* Tail-Prüfsumme eines Satzes: SHA-256 über Record und Transaktionen
+ * in Datei-Reihenfolge. */
+static void eltt_chain_file_record_checksum(const eltt_chain_file_record *rec,
+                                            const eltt_transaction *txs,
+                                            uint8_t out[32])
+{
+    eltt_sha256_ctx ctx;
+    eltt_sha256_init(&ctx);
+    eltt_sha256_update(&ctx, (const uint8_t *)rec, sizeof(*rec));
+    if (rec->tx_count > 0) {
+        eltt_sha256_update(&ctx, (const uint8_t *)txs,
+                           (size_t)rec->tx_count * sizeof(eltt_transaction));
+    }
+    eltt_sha256_final(&ctx, out);
+}
+
+/* Prüfsumme des letzten Blocks einer Chain, wie sie im Header steht. */
+static void eltt_chain_file_tail_checksum(const eltt_block *tip, uint8_t out[32])
+{
+    eltt_chain_file_record rec;
+    eltt_chain_file_record_from_block(tip, &rec);
+    eltt_chain_file_record_checksum(&rec, tip->txs, out);
+}
+
+static int eltt_chain_file_write_record(FILE *fp, const eltt_block *block)
+{
+    eltt_chain_file_record rec;
+    eltt_chain_file_record_from_block(block, &rec);
+    if (fwrite(&rec, sizeof(rec), 1, fp) != 1) {
+        return 0;
+    }
+    if (block->tx_count > 0 &&
+        fwrite(block->txs, sizeof(eltt_transaction), block->tx_count, fp)
+            != block->tx_count) {
+        return 0;
+    }
+    return 1;
+}
+
+/* Schreibt die gesamte Chain als neues Chain-File (vollständiger Dump). */
+static int eltt_chain_file_save(const eltt_blockchain *bc, const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        return 0;
+    }
+
+    eltt_chain_file_header hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, ELTT_CHAIN_FILE_MAGIC, 8);
+    hdr.version = ELTT_CHAIN_FILE_VERSION;
+    hdr.block_count = (uint64_t)bc->block_count;
+    if (bc->block_count > 0) {
+        eltt_chain_file_tail_checksum(eltt_get_block(bc, bc->block_count - 1),
+                                      hdr.tail_checksum);
+    }
+
+    if (fwrite(&hdr, sizeof(hdr), 1, fp) != 1) {
+        fclose(fp);
+        return 0;
+    }
+    for (size_t i = 0; i < bc->block_count; ++i) {
+        if (!eltt_chain_file_write_record(fp, eltt_get_block(bc, i))) {
+            fclose(fp);
+            return 0;
+        }
+    }
+    return fclose(fp) == 0;
+}
+
+/* Hängt genau einen Block sequentiell an ein bestehendes Chain-File an
+ * und aktualisiert Blockzahl und Tail-Prüfsumme im Header. */
+static int eltt_chain_file_append(const char *path, const eltt_block *block)
+{
+    FILE *fp = fopen(path, "r+b");
+    if (!fp) {
+        return 0;
+    }
+
+    eltt_chain_file_header hdr;
+    if (fread(&hdr, sizeof(hdr), 1, fp) != 1 ||
+        memcmp(hdr.magic, ELTT_CHAIN_FILE_MAGIC, 8) != 0 ||
+        hdr.version != ELTT_CHAIN_FILE_VERSION ||
+        (uint64_t)block->index != hdr.block_count) {
+        fclose(fp);
+        return 0;
+    }
+
+    if (fseek(fp, 0, SEEK_END) != 0 ||
+        !eltt_chain_file_write_record(fp, block)) {
+        fclose(fp);
+        return 0;
+    }
+
+    hdr.block_count++;
+    eltt_chain_file_tail_checksum(block, hdr.tail_checksum);
+    if (fseek(fp, 0, SEEK_SET) != 0 ||
+        fwrite(&hdr, sizeof(hdr), 1, fp) != 1) {
+        fclose(fp);
+        return 0;
+    }
+    return fclose(fp) == 0;
+}
+
+/* Lädt ein Chain-File in eine initialisierte Blockchain. Die Datei
+ * wird read-only gemappt; die Sätze werden in den segmentierten
+ * Speicher kopiert und für den Aktivitäts-Index aufbereitet. Blöcke
+ * vor apply_from werden nur übernommen, nicht angewendet (ihr Effekt
+ * steckt bereits im Zustand des Aufrufers, etwa aus einem Snapshot);
+ * ab apply_from wird normal angewendet. Es wird nur der letzte Block
+ * nachgehasht (Tail-Prüfsumme), keine Voll-Validierung. */
+static int eltt_chain_file_load_from(eltt_blockchain *bc, const char *path,
+                                     size_t apply_from)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(eltt_chain_file_header)) {
+        close(fd);
+        return 0;
+    }
+    size_t file_len = (size_t)st.st_size;
+    const uint8_t *base =
+        (const uint8_t *)mmap(NULL, file_len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return 0;
+    }
+
+    const eltt_chain_file_header *hdr = (const eltt_chain_file_header *)base;
+    if (memcmp(hdr->magic, ELTT_CHAIN_FILE_MAGIC, 8) != 0 ||
+        hdr->version != ELTT_CHAIN_FILE_VERSION) {
+        munmap((void *)base, file_len);
+        return 0;
+    }
+
+    int ok = 1;
+    size_t off = sizeof(eltt_chain_file_header);
+    const eltt_chain_file_record *tail_rec = NULL;
+    const eltt_transaction *tail_txs = NULL;
+    for (uint64_t b = 0; ok && b < hdr->block_count; ++b) {
+        if (off + sizeof(eltt_chain_file_record) > file_len) {
+            ok = 0;
+            break;
+        }
+        const eltt_chain_file_record *rec =
+            (const eltt_chain_file_record *)(base + off);
+        off += sizeof(eltt_chain_file_record);
+        size_t tx_bytes = (size_t)rec->tx_count * sizeof(eltt_transaction);
+        if (rec->tx_count > ELTT_MAX_TX_PER_BLOCK || off + tx_bytes > file_len) {
+            ok = 0;
+            break;
+        }
+        const eltt_transaction *file_txs =
+            (const eltt_transaction *)(base + off);
+        off += tx_bytes;
+        tail_rec = rec;
+        tail_txs = file_txs;
+
+        eltt_block *slot = eltt_block_store_next_slot(bc);
+        if (!slot) {
+            ok = 0;
+            break;
+        }
+        memset(slot, 0, sizeof(*slot));
+        slot->index = rec->index;
+        slot->timestamp = rec->timestamp;
+        memcpy(slot->prev_hash, rec->prev_hash, 32);
+        memcpy(slot->hash, rec->hash, 32);
+        memcpy(slot->merkle_root, rec->merkle_root, 32);
+        slot->tx_count = rec->tx_count;
+        if (rec->tx_count > 0) {
+            eltt_transaction *arena_txs = eltt_tx_arena_alloc(bc, rec->tx_count);
+            if (!arena_txs) {
+                ok = 0;
+                break;
+            }
+            memcpy(arena_txs, file_txs, tx_bytes);
+            slot->txs = arena_txs;
+        } else {
+            slot->txs = NULL;
+        }
+        /* IDs im Satz sind nur prozess-lokal gültig: neu vergeben. */
+        eltt_block_intern_ids(slot);
+        bc->block_count++;
+
+        if ((size_t)b >= apply_from) {
+            eltt_apply_block_batch(bc, slot);
+        }
+        eltt_activity_index_block(bc, slot);
+        eltt_bloom_index_block(bc, slot);
+    }
+
+    /* Tail-Prüfsumme über die Datei-Bytes des letzten Satzes sowie
+     * Header-Hash des letzten Blocks nachrechnen. */
+    if (ok && bc->block_count > 0 && tail_rec) {
+        uint8_t checksum[32];
+        eltt_chain_file_record_checksum(tail_rec, tail_txs, checksum);
+        if (memcmp(checksum, hdr->tail_checksum, 32) != 0) {
+            ok = 0;
+        }
+        const eltt_block *tip = eltt_get_block(bc, bc->block_count - 1);
+        uint8_t expected_root[32];
+        eltt_compute_merkle_root(tip->txs, tip->tx_count, expected_root);
+        if (memcmp(expected_root, tip->merkle_root, 32) != 0) {
+            ok = 0;
+        }
+        uint8_t expected[32];
+        eltt_compute_block_hash_into(tip, expected);
+        if (memcmp(expected, tip->hash, 32) != 0) {
+            ok = 0;
+        }
+    }
+
+    munmap((void *)base, file_len);
+    if (!ok) {
+        eltt_blockchain_free(bc);
+        eltt_init_blockchain(bc);
+        return 0;
+    }
+    return 1;
+}
+
+/* ----------------------------------------------------------
+ * Persistenz: binäre Zustands-Snapshots
+ *
+ * Der Zustand nach Block N (Wallets, Guthaben, Token, Pools, Stakes)
+ * als ein Stück, mit SHA-256-Prüfsumme über die Nutzdaten und dem
+ * Hash des Blocks, zu dem der Zustand gehört. Ein Neustart lädt den
+ * Snapshot und spielt nur den Schwanz der Chain-Datei nach, statt
+ * jeden Block seit Genesis erneut anzuwenden. Wie das Chain-File ist
+ * das Format host-nativ und als lokaler Cache gedacht.
+ * ---------------------------------------------------------- */
+
+#define ELTT_SNAPSHOT_MAGIC   "ELTTSNP1"
+/* Version 2: Guthaben-Zeilen als Festkomma-int64 (eltt_amount_fp)
+ * Version 3: Staking-Reward-Akkumulatoren hinter den Positionen
+ * Version 4: Höhe und Anker-Hash des Headers im Checksummen-Umfang */
+#define ELTT_SNAPSHOT_VERSION 4u
+
+typedef struct {
+    char     magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t block_count;    /* Blöcke [0, block_count) sind enthalten */
+    uint8_t  block_hash[32]; /* Hash von Block block_count-1 */
+    uint64_t wallet_count;
+    uint64_t token_count;
+    uint64_t pool_count;
+    uint64_t stake_count;
+    uint8_t  checksum[32];   /* SHA-256 über die Nutzdaten */
+} eltt_snapshot_header;
+
+/* Nutzdaten in Datei-Reihenfolge: wallets, je Token eine Guthaben-
+ * Zeile (wallet_count Doubles), token_types, pools, stakes. Höhe und
+ * Anker-Hash aus dem Header laufen mit in die Checksumme — sonst
+ * könnte ein umgekipptes Header-Feld den Restore auf den falschen
+ * Block-Bereich schicken, obwohl die Nutzdaten intakt sind. */
+static void eltt_snapshot_payload_checksum(const eltt_blockchain *bc,
+                                           uint64_t block_count,
+                                           const uint8_t block_hash[32],
+                                           uint8_t out[32])
+{
+    eltt_sha256_ctx ctx;
+    eltt_sha256_init(&ctx);
+    eltt_sha256_update(&ctx, (const uint8_t *)&block_count,
+                       sizeof(block_count));
+    eltt_sha256_update(&ctx, block_hash, 32);
+    eltt_sha256_update(&ctx, (const uint8_t *)bc->wallets,
+                       bc->wallet_count * sizeof(eltt_wallet));
+    for (size_t t = 0; t < bc->token_count; ++t) {
+        eltt_sha256_update(&ctx, (const uint8_t *)bc->wallet_balances[t],
+                           bc->wallet_count * sizeof(eltt_amount_fp));
+    }
+    eltt_sha256_update(&ctx, (const uint8_t *)bc->token_types,
+                       bc->token_count * sizeof(eltt_token_type));
+    eltt_sha256_update(&ctx, (const uint8_t *)bc->pools,
+                       bc->pool_count * sizeof(eltt_liquidity_pool));
+    eltt_sha256_update(&ctx, (const uint8_t *)bc->stakes,
+                       bc->stake_count * sizeof(eltt_staking_position));
+    eltt_sha256_update(&ctx, (const uint8_t *)bc->stake_reward_per_token,
+                       bc->token_count * sizeof(double));
+    eltt_sha256_update(&ctx, (const uint8_t *)&bc->stake_accrual_timestamp,
+                       sizeof(bc->stake_accrual_timestamp));
+    eltt_sha256_final(&ctx, out);
+}
+
+static int eltt_snapshot_save(const eltt_blockchain *bc, const char *path)
+{
+    if (bc->block_count == 0) {
+        return 0;
+    }
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        return 0;
+    }
+    eltt_snapshot_header hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, ELTT_SNAPSHOT_MAGIC, 8);
+    hdr.version = ELTT_SNAPSHOT_VERSION;
+    hdr.block_count = bc->block_count;
+    memcpy(hdr.block_hash,
+           eltt_get_block(bc, bc->block_count - 1)->hash, 32);
+    hdr.wallet_count = bc->wallet_count;
+    hdr.token_count = bc->token_count;
+    hdr.pool_count = bc->pool_count;
+    hdr.stake_count = bc->stake_count;
+    eltt_snapshot_payload_checksum(bc, hdr.block_count, hdr.block_hash,
+                                   hdr.checksum);
+
+    int ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+    ok = ok && (bc->wallet_count == 0 ||
+                fwrite(bc->wallets, sizeof(eltt_wallet),
+                       bc->wallet_count, fp) == bc->wallet_count);
+    for (size_t t = 0; ok && t < bc->token_count; ++t) {
+        ok = bc->wallet_count == 0 ||
+             fwrite(bc->wallet_balances[t], sizeof(eltt_amount_fp),
+                    bc->wallet_count, fp) == bc->wallet_count;
+    }
+    ok = ok && (bc->token_count == 0 ||
+                fwrite(bc->token_types, sizeof(eltt_token_type),
+                       bc->token_count, fp) == bc->token_count);
+    ok = ok && (bc->pool_count == 0 ||
+                fwrite(bc->pools, sizeof(eltt_liquidity_pool),
+                       bc->pool_count, fp) == bc->pool_count);
+    ok = ok && (bc->stake_count == 0 ||
+                fwrite(bc->stakes, sizeof(eltt_staking_position),
+                       bc->stake_count, fp) == bc->stake_count);
+    ok = ok && fwrite(bc->stake_reward_per_token, sizeof(double),
+                      bc->token_count, fp) == bc->token_count;
+    ok = ok && fwrite(&bc->stake_accrual_timestamp,
+                      sizeof(bc->stake_accrual_timestamp), 1, fp) == 1;
+    if (fclose(fp) != 0) {
+        ok = 0;
+    }
+    return ok;
+}
+
+/* Lädt einen Snapshot in das frisch initialisierte bc (Zustand, kein
+ * Block-Speicher) und liefert Höhe und Block-Hash des Standes. */
+static int eltt_snapshot_load(eltt_blockchain *bc, const char *path,
+                              uint64_t *out_block_count,
+                              uint8_t out_block_hash[32])
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        (size_t)st.st_size < sizeof(eltt_snapshot_header)) {
+        close(fd);
+        return 0;
+    }
+    size_t file_len = (size_t)st.st_size;
+    const uint8_t *base =
+        (const uint8_t *)mmap(NULL, file_len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return 0;
+    }
+
+    const eltt_snapshot_header *hdr = (const eltt_snapshot_header *)base;
+    int ok = memcmp(hdr->magic, ELTT_SNAPSHOT_MAGIC, 8) == 0 &&
+             hdr->version == ELTT_SNAPSHOT_VERSION &&
+             hdr->block_count >= 1 &&
+             hdr->wallet_count <= ELTT_MAX_WALLETS &&
+             hdr->token_count <= ELTT_MAX_TOKEN_TYPES &&
+             hdr->pool_count <= ELTT_MAX_POOLS &&
+             hdr->stake_count <= ELTT_MAX_STAKES;
+
+    size_t need = sizeof(eltt_snapshot_header);
+    if (ok) {
+        need += (size_t)hdr->wallet_count * sizeof(eltt_wallet);
+        need += (size_t)hdr->token_count * (size_t)hdr->wallet_count *
+                sizeof(eltt_amount_fp);
+        need += (size_t)hdr->token_count * sizeof(eltt_token_type);
+        need += (size_t)hdr->pool_count * sizeof(eltt_liquidity_pool);
+        need += (size_t)hdr->stake_count * sizeof(eltt_staking_position);
+        need += (size_t)hdr->token_count * sizeof(double);
+        need += sizeof(uint64_t);
+        ok = need <= file_len;
+    }
+
+    if (ok) {
+        const uint8_t *p = base + sizeof(eltt_snapshot_header);
+        bc->wallet_count = (size_t)hdr->wallet_count;
+        memcpy(bc->wallets, p, bc->wallet_count * sizeof(eltt_wallet));
+        p += bc->wallet_count * sizeof(eltt_wallet);
+        bc->token_count = (size_t)hdr->token_count;
+        for (size_t t = 0; t < bc->token_count; ++t) {
+            memcpy(bc->wallet_balances[t], p,
+                   bc->wallet_count * sizeof(eltt_amount_fp));
+            p += bc->wallet_count * sizeof(eltt_amount_fp);
+        }
+        memcpy(bc->token_types, p, bc->token_count * sizeof(eltt_token_type));
+        p += bc->token_count * sizeof(eltt_token_type);
+        bc->pool_count = (size_t)hdr->pool_count;
+        memcpy(bc->pools, p, bc->pool_count * sizeof(eltt_liquidity_pool));
+        p += bc->pool_count * sizeof(eltt_liquidity_pool);
+        bc->stake_count = (size_t)hdr->stake_count;
+        memcpy(bc->stakes, p, bc->stake_count * sizeof(eltt_staking_position));
+        p += bc->stake_count * sizeof(eltt_staking_position);
+        memcpy(bc->stake_reward_per_token, p, bc->token_count * sizeof(double));
+        p += bc->token_count * sizeof(double);
+        memcpy(&bc->stake_accrual_timestamp, p,
+               sizeof(bc->stake_accrual_timestamp));
+
+        uint8_t checksum[32];
+        eltt_snapshot_payload_checksum(bc, hdr->block_count,
+                                       hdr->block_hash, checksum);
+        ok = memcmp(checksum, hdr->checksum, 32) == 0;
+    }
+
+    if (ok) {
+        /* Abgeleitete Strukturen nachziehen: Adress-Index und
+         * materialisierte Pool-Ansicht. */
+        for (size_t i = 0; i < bc->wallet_count; ++i) {
+            eltt_wallet_index_insert(bc, bc->wallets[i].address, (int)i);
+            uint32_t id = eltt_address_intern(bc->wallets[i].address);
+            if (id) {
+                bc->id_to_wallet[id] = (int32_t)i;
+            }
+        }
+        for (size_t p2 = 0; p2 < bc->pool_count; ++p2) {
+            eltt_view_sync_pool(bc, p2);
+        }
+        bc->pool_view_count = bc->pool_count;
+        *out_block_count = hdr->block_count;
+        memcpy(out_block_hash, hdr->block_hash, 32);
+    }
+
+    munmap((void *)base, file_len);
+    if (!ok) {
+        eltt_init_blockchain(bc);
+        return 0;
+    }
+    return 1;
+}
+
+/* Neustart aus Snapshot plus Chain-Datei: lädt den Zustand, übernimmt
+ * die bereits abgedeckten Blöcke nur in den Block-Speicher und wendet
+ * ausschließlich den Schwanz an. Prüft, dass der Block an der
+ * Snapshot-Höhe zum gemerkten Hash passt. Bei jedem Fehler bleibt bc
+ * leer initialisiert zurück. */
+static int eltt_blockchain_restore_impl(eltt_blockchain *bc,
+                                        const char *snapshot_path,
+                                        const char *chain_path)
+{
+    eltt_init_blockchain(bc);
+
+    uint64_t snap_blocks = 0;
+    uint8_t snap_hash[32];
+    if (!eltt_snapshot_load(bc, snapshot_path, &snap_blocks, snap_hash)) {
+        return 0;
     }
-    return idx;
+    if (snap_blocks == 0) {
+        /* Wird bereits vom Loader abgewiesen; hier nur Absicherung,
+         * bevor der Anker bei snap_blocks - 1 dereferenziert wird. */
+        eltt_init_blockchain(bc);
+        return 0;
+    }
+    if (!eltt_chain_file_load_from(bc, chain_path, (size_t)snap_blocks)) {
+        /* load_from hat bc bereits zurückgesetzt */
+        return 0;
+    }
+    if (bc->block_count < snap_blocks) {
+        eltt_blockchain_free(bc);
+        eltt_init_blockchain(bc);
+        return 0;
+    }
+    const eltt_block *anchor = eltt_get_block(bc, (size_t)snap_blocks - 1);
+    if (memcmp(anchor->hash, snap_hash, 32) != 0) {
+        eltt_blockchain_free(bc);
+        eltt_init_blockchain(bc);
+        return 0;
+    }
+    return 1;
 }
 
 /* ----------------------------------------------------------
- * Validierung von Transaktionen
+ * Shared-Memory-Export (Wallet-Bridge)
+ *
+ * Die Parity-Module (ELTT-Wallet.c) laufen in eigenen Prozessen; statt
+ * JSON über eine Pipe zu schieben, exportiert die Engine die für
+ * Wallet-Abfragen relevanten Teile ihres Zustands in ein POSIX-Shared-
+ * Memory-Segment. Ein Seqlock schützt die Konsistenz: der Publisher
+ * erhöht die Sequenznummer vor und nach dem Schreiben (ungerade =
+ * Schreiben läuft), Leser wiederholen ihre Kopie, bis die Nummer vor
+ * und nach dem Lesen identisch und gerade war. Eine Guthaben-Abfrage
+ * kostet damit einen Shared-Memory-Read statt eines Roundtrips.
  * ---------------------------------------------------------- */
 
-static int eltt_validate_transaction(const eltt_blockchain *bc, const eltt_transaction *tx)
+#define ELTT_BRIDGE_SHM_NAME   "/eltt-wallet-bridge"
+#define ELTT_BRIDGE_MAGIC      0x454c5442u /* "ELTB" */
+#define ELTT_BRIDGE_VERSION    1u
+#define ELTT_BRIDGE_RECENT_TXS 256
+
+/* Kompakter Transaktionssatz für den Recent-Ring (ohne Memo/IDs). */
+typedef struct {
+    char     from[ELTT_MAX_ADDRESS_LEN];
+    char     to[ELTT_MAX_ADDRESS_LEN];
+    double   amount;
+    int32_t  token_index;
+    int32_t  kind;
+    uint32_t block_index;
+    uint64_t timestamp;
+} eltt_bridge_tx;
+
+/* Layout des Segments (muss mit ELTT-Wallet.c übereinstimmen). */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    _Atomic uint64_t sequence;
+    uint64_t block_count;
+    uint32_t wallet_count;
+    uint32_t token_count;
+    char token_symbols[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_TOKEN_SYMBOL_LEN];
+    char wallet_addresses[ELTT_MAX_WALLETS][ELTT_MAX_ADDRESS_LEN];
+    eltt_amount_fp balances[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_WALLETS];
+    /* Nonce je Wallet: Zahl der indizierten Transaktionen (monoton). */
+    uint64_t nonces[ELTT_MAX_WALLETS];
+    uint32_t recent_count;
+    eltt_bridge_tx recent[ELTT_BRIDGE_RECENT_TXS];
+} eltt_bridge_shm;
+
+static eltt_bridge_shm *eltt_bridge_segment = NULL;
+
+/* Öffnet (oder erzeugt) das Segment und mappt es einmalig. */
+static eltt_bridge_shm *eltt_bridge_map(void)
 {
-    if (tx->token_index < 0 || (size_t)tx->token_index >= bc->token_count) {
-        return 0;
+    if (eltt_bridge_segment) {
+        return eltt_bridge_segment;
     }
-    if (tx->amount < 0.0) {
+    int fd = shm_open(ELTT_BRIDGE_SHM_NAME, O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (ftruncate(fd, (off_t)sizeof(eltt_bridge_shm)) != 0) {
+        close(fd);
+        return NULL;
+    }
+    void *p = mmap(NULL, sizeof(eltt_bridge_shm), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return NULL;
+    }
+    eltt_bridge_segment = (eltt_bridge_shm *)p;
+    return eltt_bridge_segment;
+}
+
+/* Schreibt einen vollständigen Export unter Seqlock-Schutz. Wird vom
+ * Host nach dem Anhängen von Blöcken aufgerufen (nicht aus dem Append-
+ * Pfad selbst — der Export kopiert mehrere hundert KB). */
+int eltt_blockchain_bridge_publish(const eltt_blockchain *bc)
+{
+    eltt_bridge_shm *shm = eltt_bridge_map();
+    if (!shm) {
         return 0;
     }
 
-    int from_idx = eltt_find_wallet_index(bc, tx->from);
-    int to_idx   = eltt_find_wallet_index(bc, tx->to);
+    uint64_t seq = atomic_load_explicit(&shm->sequence, memory_order_relaxed);
+    atomic_store_explicit(&shm->sequence, seq + 1, memory_order_release);
+    atomic_thread_fence(memory_order_seq_cst);
 
-    switch (tx->kind) {
-        case ELTT_TX_KIND_TRANSFER:
-        case ELTT_TX_KIND_SWAP:
-        case ELTT_TX_KIND_STAKE:
-            if (from_idx < 0) return 0;
-            if (bc->wallets[from_idx].balances[tx->token_index] < tx->amount) return 0;
-            if (tx->amount <= 0.0) return 0;
-            break;
-        case ELTT_TX_KIND_MINT:
-            if (to_idx < 0) return 0;
-            if (tx->amount <= 0.0) return 0;
-            break;
-        case ELTT_TX_KIND_BURN:
-            if (from_idx < 0) return 0;
-            if (bc->wallets[from_idx].balances[tx->token_index] < tx->amount) return 0;
-            if (tx->amount <= 0.0) return 0;
-            break;
-        case ELTT_TX_KIND_CREATE_TOKEN:
-        case ELTT_TX_KIND_CREATE_POOL:
-        case ELTT_TX_KIND_ADD_LIQUIDITY:
-        case ELTT_TX_KIND_REMOVE_LIQUIDITY:
-        case ELTT_TX_KIND_UNSTAKE:
-        case ELTT_TX_KIND_CLAIM_REWARDS:
-        case ELTT_TX_KIND_PROFILE_UPDATE:
-        case ELTT_TX_KIND_GOVERNANCE_PROPOSAL:
-            break;
-        default:
-            return 0;
+    shm->magic = ELTT_BRIDGE_MAGIC;
+    shm->version = ELTT_BRIDGE_VERSION;
+    shm->block_count = (uint64_t)bc->block_count;
+    shm->wallet_count = (uint32_t)bc->wallet_count;
+    shm->token_count = (uint32_t)bc->token_count;
+    for (size_t t = 0; t < bc->token_count; ++t) {
+        memcpy(shm->token_symbols[t], bc->token_types[t].symbol,
+               ELTT_MAX_TOKEN_SYMBOL_LEN);
+    }
+    for (size_t i = 0; i < bc->wallet_count; ++i) {
+        memcpy(shm->wallet_addresses[i], bc->wallets[i].address,
+               ELTT_MAX_ADDRESS_LEN);
+        shm->nonces[i] = (uint64_t)bc->activity[i].count;
+    }
+    for (size_t t = 0; t < bc->token_count; ++t) {
+        memcpy(shm->balances[t], bc->wallet_balances[t],
+               bc->wallet_count * sizeof(eltt_amount_fp));
+    }
+
+    /* Recent-Ring: die jüngsten Transaktionen rückwärts vom Tip. */
+    uint32_t n = 0;
+    for (size_t b = bc->block_count; b > 0 && n < ELTT_BRIDGE_RECENT_TXS; --b) {
+        const eltt_block *blk = eltt_get_block(bc, b - 1);
+        for (size_t t = blk->tx_count; t > 0 && n < ELTT_BRIDGE_RECENT_TXS; --t) {
+            const eltt_transaction *tx = &blk->txs[t - 1];
+            eltt_bridge_tx *r = &shm->recent[n++];
+            memcpy(r->from, tx->from, ELTT_MAX_ADDRESS_LEN);
+            memcpy(r->to, tx->to, ELTT_MAX_ADDRESS_LEN);
+            r->amount = tx->amount;
+            r->token_index = tx->token_index;
+            r->kind = (int32_t)tx->kind;
+            r->block_index = blk->index;
+            r->timestamp = blk->timestamp;
+        }
     }
+    shm->recent_count = n;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    atomic_store_explicit(&shm->sequence, seq + 2, memory_order_release);
     return 1;
 }
 
+/* Entfernt das Segment (z. B. beim geordneten Herunterfahren). */
+void eltt_blockchain_bridge_unlink(void)
+{
+    if (eltt_bridge_segment) {
+        munmap(eltt_bridge_segment, sizeof(eltt_bridge_shm));
+        eltt_bridge_segment = NULL;
+    }
+    shm_unlink(ELTT_BRIDGE_SHM_NAME);
+}
+
 /* ----------------------------------------------------------
- * Anwendung von Transaktionen auf den Zustand
+ * Öffentliche API-Funktionen (Header-ähnlich)
  * ---------------------------------------------------------- */
 
-static void eltt_apply_transaction(eltt_blockchain *bc, const eltt_transaction *tx)
+void eltt_blockchain_init(eltt_blockchain *bc)
 {
-    int from_idx = eltt_find_or_create_wallet(bc, tx->from);
-    int to_idx   = eltt_find_or_create_wallet(bc, tx->to);
+    eltt_init_blockchain(bc);
+}
 
-    switch (tx->kind) {
-        case ELTT_TX_KIND_TRANSFER:
-        case ELTT_TX_KIND_SWAP:
-            bc->wallets[from_idx].balances[tx->token_index] -= tx->amount;
-            bc->wallets[to_idx].balances[tx->token_index]   += tx->amount;
-            break;
-        case ELTT_TX_KIND_MINT:
-            bc->wallets[to_idx].balances[tx->token_index] += tx->amount;
-            break;
-        case ELTT_TX_KIND_BURN:
-            bc->wallets[from_idx].balances[tx->token_index] -= tx->amount;
-            break;
-        case ELTT_TX_KIND_STAKE:
-        case ELTT_TX_KIND_UNSTAKE:
-        case ELTT_TX_KIND_CLAIM_REWARDS:
-        case ELTT_TX_KIND_CREATE_TOKEN:
-        case ELTT_TX_KIND_CREATE_POOL:
-        case ELTT_TX_KIND_ADD_LIQUIDITY:
-        case ELTT_TX_KIND_REMOVE_LIQUIDITY:
-        case ELTT_TX_KIND_PROFILE_UPDATE:
-        case ELTT_TX_KIND_GOVERNANCE_PROPOSAL:
-            break;
-        default:
-            break;
+void eltt_blockchain_free(eltt_blockchain *bc)
+{
+    for (size_t i = 0; i < ELTT_MAX_BLOCK_CHUNKS; ++i) {
+        if (bc->block_chunks[i]) {
+            free(bc->block_chunks[i]);
+            bc->block_chunks[i] = NULL;
+        }
+        if (bc->bloom_chunks[i]) {
+            free(bc->bloom_chunks[i]);
+            bc->bloom_chunks[i] = NULL;
+        }
+    }
+    bc->block_count = 0;
+    for (size_t i = 0; i < bc->tx_chunk_count; ++i) {
+        free(bc->tx_chunks[i]);
+        bc->tx_chunks[i] = NULL;
+    }
+    bc->tx_chunk_count = 0;
+    bc->tx_chunk_used = 0;
+    for (size_t i = 0; i < ELTT_MAX_WALLETS; ++i) {
+        free(bc->activity[i].refs);
+        bc->activity[i].refs = NULL;
+        bc->activity[i].count = 0;
+        bc->activity[i].cap = 0;
     }
 }
 
-/* ----------------------------------------------------------
- * Block-Validierung und Chain-Aufbau
- * ---------------------------------------------------------- */
+int eltt_blockchain_add_block(eltt_blockchain *bc, const eltt_block *block)
+{
+    return eltt_append_block(bc, block);
+}
 
-static int eltt_validate_block(const eltt_blockchain *bc, const eltt_block *block)
+void eltt_blockchain_create_genesis(eltt_blockchain *bc,
+                                    const char *owner_address,
+                                    uint64_t timestamp)
 {
-    if (block->index == 0) {
-        uint8_t zero[32];
-        memset(zero, 0, 32);
-        if (memcmp(block->prev_hash, zero, 32) != 0) {
-            return 0;
-        }
-    } else {
+    eltt_block genesis;
+    eltt_build_genesis_block(&genesis, owner_address, timestamp);
+    eltt_append_block(bc, &genesis);
+}
+
+double eltt_blockchain_compute_tx_energy(const eltt_transaction *tx)
+{
+    return eltt_energy_from_transaction(tx);
+}
+
+/* Batch-Variante für Analytik über Transaktions-Bereiche (Energie-
+ * Charts, BIP-Einträge): hasht Cache-Misses mehrspurig statt einzeln.
+ * out[i] ist identisch zu eltt_blockchain_compute_tx_energy(&txs[i]). */
+void eltt_blockchain_compute_tx_energy_batch(const eltt_transaction *txs,
+                                             size_t n, double *out)
+{
+    while (n > 0) {
+        size_t chunk = (n < ELTT_MAX_TX_PER_BLOCK) ? n : ELTT_MAX_TX_PER_BLOCK;
+        eltt_energy_batch_chunk(txs, chunk, out);
+        txs += chunk;
+        out += chunk;
+        n -= chunk;
+    }
+}
+
+/* Einheiten-Symbol der größten SI- bzw. Binär-Einheit, die in die
+ * Byte-Größe passt (verzweigungsfreie Auswahl, für Anzeige/Diagnose). */
+const char *eltt_blockchain_si_unit_symbol(size_t bytes)
+{
+    return ELTT_SI_BYTE_TABLE[eltt_si_byte_unit_index((double)bytes)].symbol;
+}
+
+const char *eltt_blockchain_binary_unit_symbol(size_t bytes)
+{
+    return ELTT_BINARY_BYTE_TABLE[eltt_binary_byte_unit_index((double)bytes)].symbol;
+}
+
+/* Wärmt den Energie-Cache für die Blöcke [first_block, last_block] vor,
+ * damit anschließende Energie-Abfragen über heiße Blöcke (z. B. das
+ * Chain-Grid des Viewers) als Lookup statt als Hash laufen.
+ * Gibt die Zahl der besuchten Transaktionen zurück. */
+size_t eltt_blockchain_prewarm_energy_cache(const eltt_blockchain *bc,
+                                            size_t first_block,
+                                            size_t last_block)
+{
+    size_t visited = 0;
+    if (last_block >= bc->block_count) {
         if (bc->block_count == 0) {
             return 0;
         }
-        const eltt_block *prev = &bc->blocks[bc->block_count - 1];
-        if (block->index != prev->index + 1) {
-            return 0;
-        }
-        if (memcmp(block->prev_hash, prev->hash, 32) != 0) {
-            return 0;
+        last_block = bc->block_count - 1;
+    }
+    for (size_t b = first_block; b <= last_block; ++b) {
+        const eltt_block *block = eltt_get_block(bc, b);
+        for (size_t t = 0; t < block->tx_count; ++t) {
+            (void)eltt_energy_from_transaction(&block->txs[t]);
+            visited++;
         }
     }
+    return visited;
+}
 
-    eltt_block tmp = *block;
-    eltt_compute_block_hash(&tmp);
-    if (memcmp(tmp.hash, block->hash, 32) != 0) {
-        return 0;
+/* Leert den Energie-Cache (z. B. für Benchmarks mit kaltem Cache). */
+void eltt_blockchain_energy_cache_reset(void)
+{
+    memset(eltt_energy_cache, 0, sizeof(eltt_energy_cache));
+}
+
+/* Hasht n unabhängige Nachrichten; nutzt auf geeigneter Hardware das
+ * mehrspurige Backend (bis zu 8 Nachrichten pro Durchlauf). Die Ausgabe
+ * ist bitidentisch zu n Einzelaufrufen von SHA-256. */
+void eltt_sha256_many(const uint8_t **msgs, const size_t *lens,
+                      size_t n, uint8_t (*out)[32])
+{
+    eltt_sha256_batch(msgs, lens, n, out);
+}
+
+/* Name des zur Laufzeit gewählten SHA-256-Backends (für Diagnose). */
+const char *eltt_sha256_backend_name(void)
+{
+    if (!eltt_sha256_transform_impl) {
+        eltt_sha256_select_backend();
     }
+    switch (eltt_sha256_backend_selected) {
+        case ELTT_SHA256_BACKEND_SHANI: return "sha-ni";
+        case ELTT_SHA256_BACKEND_AVX2:  return "avx2";
+        default:                        return "scalar";
+    }
+}
 
-    for (size_t i = 0; i < block->tx_count; ++i) {
-        if (!eltt_validate_transaction(bc, &block->txs[i])) {
-            return 0;
-        }
+/* Block-Hash-Berechnung als öffentliche API; wird u. a. vom Validator
+ * (ELTT-Vallidator.c) für die Re-Hash-Prüfung verwendet. */
+void eltt_blockchain_compute_block_hash(eltt_block *block)
+{
+    eltt_compute_block_hash(block);
+}
+
+/* Merkle-Wurzel über ein Transaktions-Array (Batch-Blatt-Hashing);
+ * wird u. a. vom Validator für die Commitment-Prüfung verwendet. */
+void eltt_blockchain_merkle_root(const eltt_transaction *txs, size_t tx_count,
+                                 uint8_t out_root[32])
+{
+    eltt_compute_merkle_root(txs, tx_count, out_root);
+}
+
+/* Header-Hash über die gespeicherten Felder (inklusive der im Block
+ * stehenden Merkle-Wurzel), ohne die Wurzel neu zu berechnen — für
+ * Prüfer, die das Commitment bereits separat verifiziert haben. */
+void eltt_blockchain_compute_block_header_hash(const eltt_block *block,
+                                               uint8_t out_hash[32])
+{
+    eltt_compute_block_hash_into(block, out_hash);
+}
+
+/* O(1)-Zugriff auf Block i; gemeinsame API für Viewer und Validator.
+ * Der zurückgegebene Zeiger bleibt stabil, solange die Chain lebt. */
+const eltt_block *eltt_blockchain_get_block(const eltt_blockchain *bc, size_t i)
+{
+    if (i >= bc->block_count) {
+        return NULL;
     }
+    return eltt_get_block(bc, i);
+}
 
-    return 1;
+/* O(1)-Wallet-Lookup über den Adress-Index.
+ * Gemeinsame API für Engine und Viewer (ELTT-Viewer.c).
+ * Gibt den Wallet-Index zurück oder -1, wenn die Adresse unbekannt ist. */
+/* Schreibt die gesamte Chain als binäres Chain-File (siehe Format oben).
+ * Gibt 1 bei Erfolg zurück, sonst 0. */
+int eltt_blockchain_chain_file_save(const eltt_blockchain *bc, const char *path)
+{
+    return eltt_chain_file_save(bc, path);
 }
 
-static int eltt_append_block(eltt_blockchain *bc, const eltt_block *block)
+/* Hängt einen bereits aufgenommenen Block an ein bestehendes Chain-File
+ * an (sequentielles Schreiben, kein Voll-Dump). Gibt 1 bei Erfolg zurück. */
+int eltt_blockchain_chain_file_append(const char *path, const eltt_block *block)
+{
+    return eltt_chain_file_append(path, block);
+}
+
+/* Lädt ein Chain-File in eine frisch initialisierte Blockchain
+ * (mmap + Tail-Prüfsumme statt JSON-Replay). Bei Fehlern wird die
+ * Blockchain wieder in den Init-Zustand versetzt; gibt dann 0 zurück. */
+int eltt_blockchain_chain_file_load(eltt_blockchain *bc, const char *path)
+{
+    return eltt_chain_file_load_from(bc, path, 0);
+}
+
+/* Schreibt den aktuellen Zustand (Wallets, Guthaben, Token, Pools,
+ * Stakes) als Snapshot-Datei (siehe Format oben). Gibt 1 bei Erfolg
+ * zurück, sonst 0. */
+int eltt_blockchain_snapshot_save(const eltt_blockchain *bc, const char *path)
+{
+    return eltt_snapshot_save(bc, path);
+}
+
+/* Liest nur den Snapshot-Kopf: Block-Höhe und zugehörigen Block-Hash.
+ * Damit kann z. B. ein Validator-Checkpoint am selben Snapshot
+ * verankert werden, ohne den Zustand zu laden. */
+int eltt_blockchain_snapshot_info(const char *path,
+                                  uint64_t *out_block_count,
+                                  uint8_t out_block_hash[32])
 {
-    if (!eltt_validate_block(bc, block)) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
         return 0;
     }
-
-    eltt_block *new_blocks = (eltt_block *)realloc(bc->blocks, (bc->block_count + 1) * sizeof(eltt_block));
-    if (!new_blocks) {
+    eltt_snapshot_header hdr;
+    int ok = fread(&hdr, sizeof(hdr), 1, fp) == 1 &&
+             memcmp(hdr.magic, ELTT_SNAPSHOT_MAGIC, 8) == 0 &&
+             hdr.version == ELTT_SNAPSHOT_VERSION;
+    fclose(fp);
+    if (!ok) {
         return 0;
     }
-    bc->blocks = new_blocks;
-    bc->blocks[bc->block_count] = *block;
-    bc->block_count++;
+    *out_block_count = hdr.block_count;
+    memcpy(out_block_hash, hdr.block_hash, 32);
+    return 1;
+}
 
-    for (size_t i = 0; i < block->tx_count; ++i) {
-        eltt_apply_transaction(bc, &block->txs[i]);
+/* Neustart aus Snapshot plus Chain-Datei: nur der Schwanz hinter der
+ * Snapshot-Höhe wird erneut angewendet. Bei Fehlern (Snapshot kaputt,
+ * Chain-Datei kürzer als der Snapshot, Hash-Anker passt nicht) bleibt
+ * bc leer initialisiert; gibt dann 0 zurück. */
+int eltt_blockchain_restore(eltt_blockchain *bc,
+                            const char *snapshot_path,
+                            const char *chain_path)
+{
+    return eltt_blockchain_restore_impl(bc, snapshot_path, chain_path);
+}
+
+/* Gesamtzahl der indizierten Transaktionen einer Wallet (für
+ * Pagination: Aufrufer können offset gegen diese Zahl prüfen). */
+size_t eltt_blockchain_wallet_activity_count(const eltt_blockchain *bc,
+                                             const char *address)
+{
+    int widx = eltt_find_wallet_index(bc, address);
+    if (widx < 0) {
+        return 0;
     }
+    return bc->activity[widx].count;
+}
 
-    return 1;
+/* Aktivitätsabfrage über den Posting-Listen-Index: kopiert ab offset
+ * bis zu max_entries Transaktionen der Wallet (chronologisch) nebst
+ * Block-Indizes. Läuft nur über die Einträge dieser einen Wallet. */
+size_t eltt_blockchain_wallet_activity(const eltt_blockchain *bc,
+                                       const char *address,
+                                       size_t offset,
+                                       size_t max_entries,
+                                       eltt_transaction *out_txs,
+                                       uint32_t *out_block_indices)
+{
+    int widx = eltt_find_wallet_index(bc, address);
+    if (widx < 0) {
+        return 0;
+    }
+    const eltt_activity_list *list = &bc->activity[widx];
+    size_t out_count = 0;
+    for (size_t i = offset; i < list->count && out_count < max_entries; ++i) {
+        const eltt_tx_ref *ref = &list->refs[i];
+        const eltt_block *block = eltt_get_block(bc, ref->block_index);
+        out_txs[out_count] = block->txs[ref->tx_index];
+        out_block_indices[out_count] = ref->block_index;
+        out_count++;
+    }
+    return out_count;
 }
 
-/* ----------------------------------------------------------
- * Genesis-Block-Logik (ohne Owner-Hardcoding)
- * ---------------------------------------------------------- */
+/* Bloom-Vortest: kann Block block_index die Adresse enthalten?
+ * 1 heißt "möglicherweise" (Falsch-Positive möglich), 0 heißt sicher
+ * nicht. Fehlt der Filter (Allokationsfehler), wird konservativ 1
+ * geliefert. */
+int eltt_blockchain_block_may_contain(const eltt_blockchain *bc,
+                                      size_t block_index,
+                                      const char *address)
+{
+    if (block_index >= bc->block_count) {
+        return 0;
+    }
+    const uint8_t *bloom = eltt_block_bloom(bc, block_index);
+    if (!bloom) {
+        return 1;
+    }
+    return eltt_bloom_test(bloom, address);
+}
 
-static void eltt_init_blockchain(eltt_blockchain *bc)
+/* Ad-hoc-Scan nach einer Adresse, die nicht im Wallet-Index steht
+ * (z. B. Explorer-Suche oder reine Memo-/Governance-Absender). Der
+ * Bloom-Vortest überspringt Blöcke, die die Adresse sicher nicht
+ * enthalten; nur für die verbleibenden wird das Transaktions-Array
+ * tatsächlich gelesen. */
+size_t eltt_blockchain_scan_address_txs(const eltt_blockchain *bc,
+                                        const char *address,
+                                        size_t offset,
+                                        size_t max_entries,
+                                        eltt_transaction *out_txs,
+                                        uint32_t *out_block_indices)
 {
-    memset(bc, 0, sizeof(*bc));
-    bc->blocks = NULL;
-    bc->block_count = 0;
-    bc->wallet_count = 0;
-    bc->token_count = 0;
-    bc->pool_count = 0;
-    bc->stake_count = 0;
+    size_t out_count = 0;
+    size_t skipped = 0;
+    for (size_t b = 0; b < bc->block_count && out_count < max_entries; ++b) {
+        const uint8_t *bloom = eltt_block_bloom(bc, b);
+        if (bloom && !eltt_bloom_test(bloom, address)) {
+            continue;
+        }
+        const eltt_block *block = eltt_get_block(bc, b);
+        for (size_t t = 0; t < block->tx_count && out_count < max_entries; ++t) {
+            const eltt_transaction *tx = &block->txs[t];
+            if (strcmp(tx->from, address) != 0 && strcmp(tx->to, address) != 0) {
+                continue;
+            }
+            if (skipped < offset) {
+                skipped++;
+                continue;
+            }
+            out_txs[out_count] = *tx;
+            out_block_indices[out_count] = (uint32_t)b;
+            out_count++;
+        }
+    }
+    return out_count;
+}
 
-    eltt_add_token_type(bc, "TTTC", "TTTC", 8, ELTT_TOKEN_KIND_TTTC, 0.75);
-    eltt_add_token_type(bc, "ELTT", "ELTT", 8, ELTT_TOKEN_KIND_ELTT, 0.75);
-    eltt_add_token_type(bc, "ELTC", "ELTC", 8, ELTT_TOKEN_KIND_ELTC, 0.75);
+/* Generationszähler eines Teilzustands; ändert sich nur, wenn der
+ * Apply-Pfad den Teil tatsächlich berührt hat. Viewer vergleichen den
+ * Zähler mit dem zuletzt gesehenen Stand und überspringen unveränderte
+ * Ansichten komplett. */
+uint64_t eltt_blockchain_view_generation(const eltt_blockchain *bc,
+                                         eltt_view_kind kind)
+{
+    if ((int)kind < 0 || kind >= ELTT_VIEW_COUNT) {
+        return 0;
+    }
+    return bc->view_generations[kind];
 }
 
-static void eltt_build_genesis_block(eltt_block *genesis,
-                                     const char *owner_address,
-                                     uint64_t timestamp)
+int eltt_blockchain_find_wallet(const eltt_blockchain *bc, const char *address)
 {
-    memset(genesis, 0, sizeof(*genesis));
-    genesis->index = 0;
-    genesis->timestamp = timestamp;
-    memset(genesis->prev_hash, 0, 32);
-    genesis->tx_count = 0;
+    return eltt_find_wallet_index(bc, address);
+}
 
-    eltt_compute_block_hash(genesis);
+/* Guthaben einer Wallet in Festkomma-Einheiten (10^-8 Token). */
+eltt_amount_fp eltt_blockchain_get_balance_fp(const eltt_blockchain *bc,
+                                              const char *address,
+                                              size_t token_index)
+{
+    int idx = eltt_find_wallet_index(bc, address);
+    if (idx < 0 || token_index >= bc->token_count) {
+        return 0;
+    }
+    return bc->wallet_balances[token_index][idx];
 }
 
-/* ----------------------------------------------------------
- * Öffentliche API-Funktionen (Header-ähnlich)
- * ---------------------------------------------------------- */
+/* Bequemlichkeitsvariante für Aufrufer, die mit Token-Beträgen als
+ * double weiterrechnen (JSON-Ausgabe, Anzeige). */
+double eltt_blockchain_get_balance(const eltt_blockchain *bc,
+                                   const char *address,
+                                   size_t token_index)
+{
+    return eltt_fp_to_double(eltt_blockchain_get_balance_fp(bc, address, token_index));
+}
 
-void eltt_blockchain_init(eltt_blockchain *bc)
+/* Ausstehende Staking-Rewards der Position stake_index — ein
+ * Akkumulator-Vergleich, O(1) unabhängig von der Positionszahl. */
+double eltt_blockchain_stake_pending(const eltt_blockchain *bc,
+                                     size_t stake_index)
 {
-    eltt_init_blockchain(bc);
+    if (stake_index >= bc->stake_count) {
+        return 0.0;
+    }
+    return eltt_stake_position_pending(bc, &bc->stakes[stake_index]);
 }
 
-void eltt_blockchain_free(eltt_blockchain *bc)
+/* Ausstehende Rewards von owner für einen Token (Positionssuche plus
+ * Akkumulator-Vergleich). */
+double eltt_blockchain_stake_pending_for(const eltt_blockchain *bc,
+                                         const char *owner,
+                                         int token_index)
 {
-    if (bc->blocks) {
-        free(bc->blocks);
-        bc->blocks = NULL;
+    int p = eltt_stake_find_position(bc, owner, token_index);
+    if (p < 0) {
+        return 0.0;
     }
-    bc->block_count = 0;
+    return eltt_stake_position_pending(bc, &bc->stakes[p]) +
+           bc->stakes[p].accumulated_rewards;
 }
 
-int eltt_blockchain_add_block(eltt_blockchain *bc, const eltt_block *block)
+/* Kopiert die Instrumentierungszähler in ein Plain-Abbild. Der
+ * Snapshot ist nicht über alle Felder konsistent (relaxed-Loads),
+ * jedes einzelne Feld aber monoton — ausreichend für Dashboards. */
+void eltt_stats_snapshot(eltt_stats_view *out)
 {
-    return eltt_append_block(bc, block);
+    out->blocks_appended =
+        atomic_load_explicit(&eltt_stats_state.blocks_appended, memory_order_relaxed);
+    out->blocks_rejected =
+        atomic_load_explicit(&eltt_stats_state.blocks_rejected, memory_order_relaxed);
+    out->txs_applied =
+        atomic_load_explicit(&eltt_stats_state.txs_applied, memory_order_relaxed);
+    out->block_validations =
+        atomic_load_explicit(&eltt_stats_state.block_validations, memory_order_relaxed);
+    out->wallet_lookups =
+        atomic_load_explicit(&eltt_stats_state.wallet_lookups, memory_order_relaxed);
+    out->wallets_created =
+        atomic_load_explicit(&eltt_stats_state.wallets_created, memory_order_relaxed);
+    out->sha256_messages =
+        atomic_load_explicit(&eltt_stats_state.sha256_messages, memory_order_relaxed);
+    out->sha256_batches =
+        atomic_load_explicit(&eltt_stats_state.sha256_batches, memory_order_relaxed);
+    out->energy_cache_hits =
+        atomic_load_explicit(&eltt_stats_state.energy_cache_hits, memory_order_relaxed);
+    out->energy_cache_misses =
+        atomic_load_explicit(&eltt_stats_state.energy_cache_misses, memory_order_relaxed);
+    out->activity_grows =
+        atomic_load_explicit(&eltt_stats_state.activity_grows, memory_order_relaxed);
+    out->viewer_builds =
+        atomic_load_explicit(&eltt_stats_state.viewer_builds, memory_order_relaxed);
+    for (size_t i = 0; i < ELTT_STATS_HIST_BUCKETS; ++i) {
+        out->append_ns_hist[i] = atomic_load_explicit(
+            &eltt_stats_state.append_ns_hist[i], memory_order_relaxed);
+        out->validate_ns_hist[i] = atomic_load_explicit(
+            &eltt_stats_state.validate_ns_hist[i], memory_order_relaxed);
+    }
 }
 
-void eltt_blockchain_create_genesis(eltt_blockchain *bc,
-                                    const char *owner_address,
-                                    uint64_t timestamp)
+/* Setzt alle Zähler auf null (z. B. zwischen Benchmark-Läufen). */
+void eltt_stats_reset(void)
 {
-    eltt_block genesis;
-    eltt_build_genesis_block(&genesis, owner_address, timestamp);
-    eltt_append_block(bc, &genesis);
+    atomic_store_explicit(&eltt_stats_state.blocks_appended, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.blocks_rejected, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.txs_applied, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.block_validations, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.wallet_lookups, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.wallets_created, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.sha256_messages, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.sha256_batches, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.energy_cache_hits, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.energy_cache_misses, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.activity_grows, 0, memory_order_relaxed);
+    atomic_store_explicit(&eltt_stats_state.viewer_builds, 0, memory_order_relaxed);
+    for (size_t i = 0; i < ELTT_STATS_HIST_BUCKETS; ++i) {
+        atomic_store_explicit(&eltt_stats_state.append_ns_hist[i], 0, memory_order_relaxed);
+        atomic_store_explicit(&eltt_stats_state.validate_ns_hist[i], 0, memory_order_relaxed);
+    }
 }
 
-double eltt_blockchain_compute_tx_energy(const eltt_transaction *tx)
+/* Hook für die Viewer-Builder (eigene Übersetzungseinheit). */
+void eltt_stats_note_viewer_build(void)
 {
-    return eltt_energy_from_transaction(tx);
+    eltt_stats_add(&eltt_stats_state.viewer_builds, 1);
 }
@@ -0,0 +1,283 @@
+/*
+ * ELTT-Json-Writer.c
+ *
+ * Zweck:
+ *   Gemeinsamer JSON-Emitter für die Root-C-Parity-Module
+ *   (ELTT-liquidtity-pools.c, ELTT-Launcher.c, ELTT-Wallet.c).
+ *   Ersetzt die snprintf-Ketten mit manueller Restplatz-Buchführung
+ *   durch einen wachsenden Puffer mit Append-Cursor und schnellen
+ *   Pfaden für Ganzzahlen und Doubles.
+ *
+ * Pfad:
+ *   Root/ELTT-Json-Writer.c
+ *
+ * Matrix-Rolle:
+ *   Neutral-Matrix (PARITY-Hilfsmodul) — keine Mutationen am
+ *   Chain-Zustand, reine Serialisierung.
+ *
+ * Exportierte API:
+ *   void eltt_json_writer_init(eltt_json_writer *w);
+ *   void eltt_json_writer_init_fixed(eltt_json_writer *w, char *buf, size_t cap);
+ *   void eltt_json_writer_free(eltt_json_writer *w);
+ *   int  eltt_json_writer_ok(const eltt_json_writer *w);
+ *   const char *eltt_json_writer_cstr(const eltt_json_writer *w);
+ *   void eltt_json_append_raw(eltt_json_writer *w, const char *s);
+ *   void eltt_json_append_char(eltt_json_writer *w, char c);
+ *   void eltt_json_append_string(eltt_json_writer *w, const char *s);
+ *   void eltt_json_append_int(eltt_json_writer *w, long long v);
+ *   void eltt_json_append_double(eltt_json_writer *w, double v);
+ *   void eltt_json_field_string(eltt_json_writer *w, const char *key, const char *value);
+ *   void eltt_json_field_int(eltt_json_writer *w, const char *key, long long v);
+ *   void eltt_json_field_double(eltt_json_writer *w, const char *key, double v);
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifndef ELTT_JSON_WRITER_H
+#define ELTT_JSON_WRITER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+ * Writer-Struktur (muss mit den Konsumenten-Modulen übereinstimmen)
+ *
+ * Zwei Betriebsarten:
+ *   - init():       Heap-Puffer, wächst geometrisch, nie stilles Kürzen.
+ *   - init_fixed(): fester Aufruferpuffer (Parity-API); läuft er voll,
+ *                   wird error gesetzt statt still abgeschnitten.
+ * Nach einem Fehler sind alle Appends No-ops; der Aufrufer prüft am
+ * Ende einmal eltt_json_writer_ok().
+ * ------------------------------------------------------------------------- */
+
+#define ELTT_JSON_WRITER_INITIAL_CAP 256
+
+typedef struct {
+    char  *buf;
+    size_t len;      /* genutzte Bytes ohne NUL-Terminator */
+    size_t cap;
+    int    owns_buf; /* 1: Heap-Puffer (wächst), 0: Aufruferpuffer (fest) */
+    int    error;    /* 1 nach Allokationsfehler oder vollem Festpuffer */
+} eltt_json_writer;
+
+/* -------------------------------------------------------------------------
+ * Lebenszyklus
+ * ------------------------------------------------------------------------- */
+
+void eltt_json_writer_init(eltt_json_writer *w)
+{
+    w->buf = (char *)malloc(ELTT_JSON_WRITER_INITIAL_CAP);
+    w->len = 0;
+    w->cap = w->buf ? ELTT_JSON_WRITER_INITIAL_CAP : 0;
+    w->owns_buf = 1;
+    w->error = w->buf ? 0 : 1;
+    if (w->buf) {
+        w->buf[0] = '\0';
+    }
+}
+
+void eltt_json_writer_init_fixed(eltt_json_writer *w, char *buf, size_t cap)
+{
+    w->buf = buf;
+    w->len = 0;
+    w->cap = cap;
+    w->owns_buf = 0;
+    w->error = (buf && cap > 0) ? 0 : 1;
+    if (buf && cap > 0) {
+        buf[0] = '\0';
+    }
+}
+
+void eltt_json_writer_free(eltt_json_writer *w)
+{
+    if (w->owns_buf) {
+        free(w->buf);
+    }
+    w->buf = NULL;
+    w->len = 0;
+    w->cap = 0;
+    w->error = 1;
+}
+
+int eltt_json_writer_ok(const eltt_json_writer *w)
+{
+    return !w->error;
+}
+
+const char *eltt_json_writer_cstr(const eltt_json_writer *w)
+{
+    return w->buf ? w->buf : "";
+}
+
+/* -------------------------------------------------------------------------
+ * Interner Platz-Check (wächst bzw. setzt error)
+ * ------------------------------------------------------------------------- */
+
+static char *eltt_json_reserve(eltt_json_writer *w, size_t n)
+{
+    if (w->error) {
+        return NULL;
+    }
+    /* n Nutzbytes + NUL müssen passen */
+    if (w->len + n + 1 > w->cap) {
+        if (!w->owns_buf) {
+            w->error = 1;
+            return NULL;
+        }
+        size_t new_cap = (w->cap == 0) ? ELTT_JSON_WRITER_INITIAL_CAP : w->cap;
+        while (w->len + n + 1 > new_cap) {
+            new_cap *= 2;
+        }
+        char *buf = (char *)realloc(w->buf, new_cap);
+        if (!buf) {
+            w->error = 1;
+            return NULL;
+        }
+        w->buf = buf;
+        w->cap = new_cap;
+    }
+    return w->buf + w->len;
+}
+
+/* -------------------------------------------------------------------------
+ * Basis-Appends
+ * ------------------------------------------------------------------------- */
+
+void eltt_json_append_raw(eltt_json_writer *w, const char *s)
+{
+    size_t n = strlen(s);
+    char *dst = eltt_json_reserve(w, n);
+    if (!dst) {
+        return;
+    }
+    memcpy(dst, s, n);
+    w->len += n;
+    w->buf[w->len] = '\0';
+}
+
+void eltt_json_append_char(eltt_json_writer *w, char c)
+{
+    char *dst = eltt_json_reserve(w, 1);
+    if (!dst) {
+        return;
+    }
+    *dst = c;
+    w->len += 1;
+    w->buf[w->len] = '\0';
+}
+
+/* JSON-String inklusive Anführungszeichen; Sonderzeichen werden
+ * escaped (die Parity-Daten sind ASCII-Bezeichner, der Pfad bleibt
+ * daher fast immer im memcpy-Schnellfall). */
+void eltt_json_append_string(eltt_json_writer *w, const char *s)
+{
+    eltt_json_append_char(w, '"');
+    const char *run = s;
+    const char *p = s;
+    while (*p) {
+        if (*p == '"' || *p == '\\' || (unsigned char)*p < 0x20) {
+            if (p > run) {
+                char *dst = eltt_json_reserve(w, (size_t)(p - run));
+                if (!dst) return;
+                memcpy(dst, run, (size_t)(p - run));
+                w->len += (size_t)(p - run);
+                w->buf[w->len] = '\0';
+            }
+            char esc[8];
+            if (*p == '"' || *p == '\\') {
+                esc[0] = '\\'; esc[1] = *p; esc[2] = '\0';
+            } else {
+                snprintf(esc, sizeof(esc), "\\u%04x", (unsigned char)*p);
+            }
+            eltt_json_append_raw(w, esc);
+            run = p + 1;
+        }
+        p++;
+    }
+    if (p > run) {
+        char *dst = eltt_json_reserve(w, (size_t)(p - run));
+        if (!dst) return;
+        memcpy(dst, run, (size_t)(p - run));
+        w->len += (size_t)(p - run);
+        w->buf[w->len] = '\0';
+    }
+    eltt_json_append_char(w, '"');
+}
+
+/* Ganzzahl-Schnellpfad: feste Ziffernbreite, kein snprintf. */
+void eltt_json_append_int(eltt_json_writer *w, long long v)
+{
+    char tmp[24];
+    char *p = tmp + sizeof(tmp);
+    unsigned long long u =
+        (v < 0) ? (unsigned long long)(-(v + 1)) + 1ULL : (unsigned long long)v;
+    do {
+        *--p = (char)('0' + (u % 10));
+        u /= 10;
+    } while (u != 0);
+    if (v < 0) {
+        *--p = '-';
+    }
+    size_t n = (size_t)(tmp + sizeof(tmp) - p);
+    char *dst = eltt_json_reserve(w, n);
+    if (!dst) {
+        return;
+    }
+    memcpy(dst, p, n);
+    w->len += n;
+    w->buf[w->len] = '\0';
+}
+
+/* Double im %.10g-Format der bisherigen Parity-Ausgabe; formatiert in
+ * einen kleinen Stack-Puffer statt mit Restplatz-Arithmetik im
+ * Zielpuffer. */
+void eltt_json_append_double(eltt_json_writer *w, double v)
+{
+    char tmp[40];
+    int n = snprintf(tmp, sizeof(tmp), "%.10g", v);
+    if (n < 0) {
+        w->error = 1;
+        return;
+    }
+    eltt_json_append_raw(w, tmp);
+}
+
+/* -------------------------------------------------------------------------
+ * Feld-Helfer ("key":wert) — der Aufrufer setzt Kommata/Klammern
+ * ------------------------------------------------------------------------- */
+
+void eltt_json_field_string(eltt_json_writer *w, const char *key, const char *value)
+{
+    eltt_json_append_char(w, '"');
+    eltt_json_append_raw(w, key);
+    eltt_json_append_raw(w, "\":");
+    eltt_json_append_string(w, value);
+}
+
+void eltt_json_field_int(eltt_json_writer *w, const char *key, long long v)
+{
+    eltt_json_append_char(w, '"');
+    eltt_json_append_raw(w, key);
+    eltt_json_append_raw(w, "\":");
+    eltt_json_append_int(w, v);
+}
+
+void eltt_json_field_double(eltt_json_writer *w, const char *key, double v)
+{
+    eltt_json_append_char(w, '"');
+    eltt_json_append_raw(w, key);
+    eltt_json_append_raw(w, "\":");
+    eltt_json_append_double(w, v);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELTT_JSON_WRITER_H */
+
+/* Ende: Root/ELTT-Json-Writer.c */
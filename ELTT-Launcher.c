@@ -24,6 +24,7 @@
  *   int parity_fetch_all_nodes(char *out_json, size_t out_len);
  *   int parity_fetch_service_health(const char *service_name, char *out_json, size_t out_len);
  *   int parity_fetch_all_services(char *out_json, size_t out_len);
+ *   int parity_fetch_engine_stats(char *out_json, size_t out_len);
  */
 
 #include <stdio.h>
@@ -75,6 +76,52 @@ typedef struct {
 /* Diese Funktion(en) werden typischerweise von einer Launcher-Engine bereitgestellt */
 extern int eltt_launcher_fetch_state(eltt_launcher_state *out_state);
 
+/* -------------------------------------------------------------------------
+ * Engine-Instrumentierung (muss mit ELTT-Blockchain.c übereinstimmen)
+ * ------------------------------------------------------------------------- */
+
+#define ELTT_STATS_HIST_BUCKETS 16
+
+typedef struct {
+    uint64_t blocks_appended;
+    uint64_t blocks_rejected;
+    uint64_t txs_applied;
+    uint64_t block_validations;
+    uint64_t wallet_lookups;
+    uint64_t wallets_created;
+    uint64_t sha256_messages;
+    uint64_t sha256_batches;
+    uint64_t energy_cache_hits;
+    uint64_t energy_cache_misses;
+    uint64_t activity_grows;
+    uint64_t viewer_builds;
+    uint64_t append_ns_hist[ELTT_STATS_HIST_BUCKETS];
+    uint64_t validate_ns_hist[ELTT_STATS_HIST_BUCKETS];
+} eltt_stats_view;
+
+extern void eltt_stats_snapshot(eltt_stats_view *out);
+
+/* -------------------------------------------------------------------------
+ * JSON-Writer (muss mit ELTT-Json-Writer.c übereinstimmen)
+ * ------------------------------------------------------------------------- */
+
+typedef struct {
+    char  *buf;
+    size_t len;
+    size_t cap;
+    int    owns_buf;
+    int    error;
+} eltt_json_writer;
+
+extern void eltt_json_writer_init_fixed(eltt_json_writer *w, char *buf, size_t cap);
+extern int  eltt_json_writer_ok(const eltt_json_writer *w);
+extern void eltt_json_append_raw(eltt_json_writer *w, const char *s);
+extern void eltt_json_append_char(eltt_json_writer *w, char c);
+extern void eltt_json_append_double(eltt_json_writer *w, double v);
+extern void eltt_json_field_string(eltt_json_writer *w, const char *key, const char *value);
+extern void eltt_json_field_int(eltt_json_writer *w, const char *key, long long v);
+extern void eltt_json_field_double(eltt_json_writer *w, const char *key, double v);
+
 /* -------------------------------------------------------------------------
  * Helper
  * ------------------------------------------------------------------------- */
@@ -90,79 +137,114 @@ static void safe_copy(char *dst, const char *src, size_t n) {
  * JSON-Serialisierung
  * ------------------------------------------------------------------------- */
 
-static int write_node_status_json(const eltt_node_status *n, char *out_json, size_t out_len) {
-    if (!n || !out_json || out_len == 0) return -1;
-    int w = snprintf(
-        out_json,
-        out_len,
-        "{\"node_id\":\"%s\",\"uptime_seconds\":%d,\"version\":\"%s\","
-        "\"peers\":%d,\"syncing\":%d,\"last_checked\":%.3f}",
-        n->node_id,
-        n->uptime_seconds,
-        n->version,
-        n->peers,
-        n->syncing,
-        n->last_checked
-    );
-    return (w >= 0 && (size_t)w < out_len) ? 0 : -2;
+/* "last_checked" wurde bisher mit %.3f ausgegeben; der Writer-Pfad
+ * behält das Format bei. */
+static void append_last_checked(eltt_json_writer *w, double last_checked) {
+    char tmp[40];
+    snprintf(tmp, sizeof(tmp), "\"last_checked\":%.3f", last_checked);
+    eltt_json_append_raw(w, tmp);
+}
+
+static void write_node_status_object(eltt_json_writer *w, const eltt_node_status *n) {
+    eltt_json_append_char(w, '{');
+    eltt_json_field_string(w, "node_id", n->node_id);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "uptime_seconds", n->uptime_seconds);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_string(w, "version", n->version);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "peers", n->peers);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "syncing", n->syncing);
+    eltt_json_append_char(w, ',');
+    append_last_checked(w, n->last_checked);
+    eltt_json_append_char(w, '}');
 }
 
 static int write_all_nodes_json(const eltt_launcher_state *state, char *out_json, size_t out_len) {
     if (!state || !out_json || out_len == 0) return -1;
-    size_t used = 0;
-    int w = snprintf(out_json + used, out_len - used, "[");
-    if (w < 0 || (size_t)w >= out_len - used) return -2;
-    used += (size_t)w;
-
+    eltt_json_writer w;
+    eltt_json_writer_init_fixed(&w, out_json, out_len);
+    eltt_json_append_char(&w, '[');
     for (size_t i = 0; i < state->node_count; ++i) {
-        char buf[256];
-        if (write_node_status_json(&state->nodes[i], buf, sizeof(buf)) != 0) return -2;
-        w = snprintf(out_json + used, out_len - used, "%s%s", (i == 0 ? "" : ","), buf);
-        if (w < 0 || (size_t)w >= out_len - used) return -2;
-        used += (size_t)w;
+        if (i > 0) eltt_json_append_char(&w, ',');
+        write_node_status_object(&w, &state->nodes[i]);
     }
-
-    w = snprintf(out_json + used, out_len - used, "]");
-    if (w < 0 || (size_t)w >= out_len - used) return -2;
-    used += (size_t)w;
-    return 0;
+    eltt_json_append_char(&w, ']');
+    return eltt_json_writer_ok(&w) ? 0 : -2;
 }
 
-static int write_service_health_json(const eltt_service_health *s, char *out_json, size_t out_len) {
-    if (!s || !out_json || out_len == 0) return -1;
-    int w = snprintf(
-        out_json,
-        out_len,
-        "{\"service\":\"%s\",\"status\":\"%s\",\"last_checked\":%.3f,"
-        "\"severity\":\"%s\",\"message\":\"%s\"}",
-        s->service,
-        s->status,
-        s->last_checked,
-        s->severity,
-        s->message
-    );
-    return (w >= 0 && (size_t)w < out_len) ? 0 : -2;
+static void write_service_health_object(eltt_json_writer *w, const eltt_service_health *s) {
+    eltt_json_append_char(w, '{');
+    eltt_json_field_string(w, "service", s->service);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_string(w, "status", s->status);
+    eltt_json_append_char(w, ',');
+    append_last_checked(w, s->last_checked);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_string(w, "severity", s->severity);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_string(w, "message", s->message);
+    eltt_json_append_char(w, '}');
 }
 
 static int write_all_services_json(const eltt_launcher_state *state, char *out_json, size_t out_len) {
     if (!state || !out_json || out_len == 0) return -1;
-    size_t used = 0;
-    int w = snprintf(out_json + used, out_len - used, "[");
-    if (w < 0 || (size_t)w >= out_len - used) return -2;
-    used += (size_t)w;
-
+    eltt_json_writer w;
+    eltt_json_writer_init_fixed(&w, out_json, out_len);
+    eltt_json_append_char(&w, '[');
     for (size_t i = 0; i < state->service_count; ++i) {
-        char buf[256];
-        if (write_service_health_json(&state->services[i], buf, sizeof(buf)) != 0) return -2;
-        w = snprintf(out_json + used, out_len - used, "%s%s", (i == 0 ? "" : ","), buf);
-        if (w < 0 || (size_t)w >= out_len - used) return -2;
-        used += (size_t)w;
+        if (i > 0) eltt_json_append_char(&w, ',');
+        write_service_health_object(&w, &state->services[i]);
     }
+    eltt_json_append_char(&w, ']');
+    return eltt_json_writer_ok(&w) ? 0 : -2;
+}
 
-    w = snprintf(out_json + used, out_len - used, "]");
-    if (w < 0 || (size_t)w >= out_len - used) return -2;
-    used += (size_t)w;
-    return 0;
+static void append_hist_array(eltt_json_writer *w, const char *key,
+                              const uint64_t *hist) {
+    eltt_json_append_char(w, '"');
+    eltt_json_append_raw(w, key);
+    eltt_json_append_raw(w, "\":[");
+    for (size_t i = 0; i < ELTT_STATS_HIST_BUCKETS; ++i) {
+        if (i > 0) eltt_json_append_char(w, ',');
+        char tmp[24];
+        snprintf(tmp, sizeof(tmp), "%llu", (unsigned long long)hist[i]);
+        eltt_json_append_raw(w, tmp);
+    }
+    eltt_json_append_char(w, ']');
+}
+
+static void write_engine_stats_object(eltt_json_writer *w, const eltt_stats_view *s) {
+    eltt_json_append_char(w, '{');
+    eltt_json_field_int(w, "blocks_appended", (long long)s->blocks_appended);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "blocks_rejected", (long long)s->blocks_rejected);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "txs_applied", (long long)s->txs_applied);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "block_validations", (long long)s->block_validations);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "wallet_lookups", (long long)s->wallet_lookups);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "wallets_created", (long long)s->wallets_created);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "sha256_messages", (long long)s->sha256_messages);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "sha256_batches", (long long)s->sha256_batches);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "energy_cache_hits", (long long)s->energy_cache_hits);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "energy_cache_misses", (long long)s->energy_cache_misses);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "activity_grows", (long long)s->activity_grows);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "viewer_builds", (long long)s->viewer_builds);
+    eltt_json_append_char(w, ',');
+    append_hist_array(w, "append_ns_hist", s->append_ns_hist);
+    eltt_json_append_char(w, ',');
+    append_hist_array(w, "validate_ns_hist", s->validate_ns_hist);
+    eltt_json_append_char(w, '}');
 }
 
 /* -------------------------------------------------------------------------
@@ -179,7 +261,10 @@ int parity_fetch_node_status(const char *node_id, char *out_json, size_t out_len
     }
     for (size_t i = 0; i < state.node_count; ++i) {
         if (strcmp(state.nodes[i].node_id, node_id) == 0) {
-            return write_node_status_json(&state.nodes[i], out_json, out_len);
+            eltt_json_writer w;
+            eltt_json_writer_init_fixed(&w, out_json, out_len);
+            write_node_status_object(&w, &state.nodes[i]);
+            return eltt_json_writer_ok(&w) ? 0 : -2;
         }
     }
     safe_copy(out_json, "{}", out_len);
@@ -197,8 +282,25 @@ int parity_fetch_all_nodes(char *out_json, size_t out_len) {
     return write_all_nodes_json(&state, out_json, out_len);
 }
 
+/* JSON-Dump der Engine-Instrumentierung (eltt_stats_snapshot) für
+ * Dashboards; auch über parity_fetch_service_health("engine-stats")
+ * erreichbar. */
+int parity_fetch_engine_stats(char *out_json, size_t out_len) {
+    if (!out_json || out_len == 0) return -1;
+    eltt_stats_view s;
+    eltt_stats_snapshot(&s);
+    eltt_json_writer w;
+    eltt_json_writer_init_fixed(&w, out_json, out_len);
+    write_engine_stats_object(&w, &s);
+    return eltt_json_writer_ok(&w) ? 0 : -2;
+}
+
 int parity_fetch_service_health(const char *service_name, char *out_json, size_t out_len) {
     if (!service_name || !out_json || out_len == 0) return -1;
+    /* Synthetischer Service: Engine-Interna statt Monitor-Zustand. */
+    if (strcmp(service_name, "engine-stats") == 0) {
+        return parity_fetch_engine_stats(out_json, out_len);
+    }
     eltt_launcher_state state;
     memset(&state, 0, sizeof(state));
     if (eltt_launcher_fetch_state(&state) != 0) {
@@ -207,7 +309,10 @@ int parity_fetch_service_health(const char *service_name, char *out_json, size_t
     }
     for (size_t i = 0; i < state.service_count; ++i) {
         if (strcmp(state.services[i].service, service_name) == 0) {
-            return write_service_health_json(&state.services[i], out_json, out_len);
+            eltt_json_writer w;
+            eltt_json_writer_init_fixed(&w, out_json, out_len);
+            write_service_health_object(&w, &state.services[i]);
+            return eltt_json_writer_ok(&w) ? 0 : -2;
         }
     }
     safe_copy(out_json, "{}", out_len);
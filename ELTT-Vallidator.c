@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <pthread.h>
 
 /* ----------------------------------------------------------
  * Gemeinsame Typen (müssen mit ELTT-Blockchain.c / ELTT-Viewer.c übereinstimmen)
@@ -34,6 +35,16 @@
 #define ELTT_MAX_WALLETS          1024
 #define ELTT_MAX_POOLS            256
 #define ELTT_MAX_STAKES           1024
+#define ELTT_WALLET_INDEX_CAP     2048
+#define ELTT_INTERN_MAX_IDS       16384
+
+/* Festkomma-Guthaben: muss mit ELTT-Blockchain.c übereinstimmen. */
+typedef int64_t eltt_amount_fp;
+#define ELTT_FP_SCALE 100000000LL
+#define ELTT_BLOCKS_PER_CHUNK     64
+#define ELTT_MAX_BLOCK_CHUNKS     8192
+#define ELTT_TX_CHUNK_CAP         4096
+#define ELTT_MAX_TX_CHUNKS        4096
 
 typedef enum {
     ELTT_TOKEN_KIND_TTTC,
@@ -53,9 +64,6 @@ typedef struct {
 
 typedef struct {
     char  address[ELTT_MAX_ADDRESS_LEN];
-    size_t token_count;
-    eltt_token_type tokens[ELTT_MAX_TOKEN_TYPES];
-    double balances[ELTT_MAX_TOKEN_TYPES];
 } eltt_wallet;
 
 typedef enum {
@@ -81,6 +89,10 @@ typedef struct {
     int   token_index;
     eltt_tx_kind kind;
     char  memo[ELTT_MAX_MEMO_LEN];
+    /* Interning-Cache (siehe ELTT-Blockchain.c): prozess-lokal,
+     * nicht Teil des Wire-Formats; 0 = nicht interniert. */
+    uint32_t from_id;
+    uint32_t to_id;
 } eltt_transaction;
 
 typedef struct {
@@ -88,8 +100,10 @@ typedef struct {
     uint64_t timestamp;
     uint8_t  prev_hash[32];
     uint8_t  hash[32];
+    /* Merkle-Wurzel über die serialisierten Transaktionen des Blocks */
+    uint8_t  merkle_root[32];
     size_t   tx_count;
-    eltt_transaction txs[ELTT_MAX_TX_PER_BLOCK];
+    eltt_transaction *txs;
 } eltt_block;
 
 typedef struct {
@@ -107,19 +121,73 @@ typedef struct {
     uint64_t start_timestamp;
     uint64_t lock_until;
     double accumulated_rewards;
+    /* Akkumulator-Snapshot, siehe ELTT-Blockchain.c */
+    double reward_per_token_snap;
 } eltt_staking_position;
 
+/* Teilzustände mit eigenem Generationszähler (muss mit
+ * ELTT-Blockchain.c übereinstimmen). */
+typedef enum {
+    ELTT_VIEW_CHAIN = 0,
+    ELTT_VIEW_WALLETS,
+    ELTT_VIEW_POOLS,
+    ELTT_VIEW_STAKES,
+    ELTT_VIEW_COUNT
+} eltt_view_kind;
+
+/* Materialisierte Pool-Ansicht (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    int pool_index;
+    int token_x_index;
+    int token_y_index;
+    double reserve_x;
+    double reserve_y;
+    int lp_token_index;
+} eltt_pool_view_entry;
+
+/* Posting-Liste für Wallet-Aktivität
+ * (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    uint32_t block_index;
+    uint32_t tx_index;
+} eltt_tx_ref;
+
+typedef struct {
+    size_t count;
+    size_t cap;
+    eltt_tx_ref *refs;
+} eltt_activity_list;
+
 typedef struct {
     size_t block_count;
-    eltt_block *blocks;
+    eltt_block *block_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    uint8_t *bloom_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    size_t tx_chunk_count;
+    size_t tx_chunk_used;
+    eltt_transaction *tx_chunks[ELTT_MAX_TX_CHUNKS];
     size_t wallet_count;
     eltt_wallet wallets[ELTT_MAX_WALLETS];
+    /* Guthaben token-major (Struct-of-Arrays), siehe ELTT-Blockchain.c */
+    eltt_amount_fp wallet_balances[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_WALLETS];
     size_t token_count;
     eltt_token_type token_types[ELTT_MAX_TOKEN_TYPES];
     size_t pool_count;
     eltt_liquidity_pool pools[ELTT_MAX_POOLS];
     size_t stake_count;
     eltt_staking_position stakes[ELTT_MAX_STAKES];
+    /* Staking-Reward-Akkumulatoren, siehe ELTT-Blockchain.c */
+    double   stake_reward_per_token[ELTT_MAX_TOKEN_TYPES];
+    uint64_t stake_accrual_timestamp;
+    int32_t wallet_index_map[ELTT_WALLET_INDEX_CAP];
+    /* Direkt-Map Intern-ID -> Wallet-Index, siehe ELTT-Blockchain.c */
+    int32_t id_to_wallet[ELTT_INTERN_MAX_IDS + 1];
+    /* Generationszähler und materialisierte Pool-Ansicht,
+     * siehe ELTT-Blockchain.c */
+    uint64_t view_generations[ELTT_VIEW_COUNT];
+    size_t pool_view_count;
+    eltt_pool_view_entry pool_view[ELTT_MAX_POOLS];
+    /* Aktivitäts-Index, siehe ELTT-Blockchain.c */
+    eltt_activity_list activity[ELTT_MAX_WALLETS];
 } eltt_blockchain;
 
 /* ----------------------------------------------------------
@@ -133,6 +201,21 @@ extern "C" {
 /* Hash-Funktion für Blöcke (muss mit ELTT-Blockchain.c übereinstimmen) */
 void eltt_blockchain_compute_block_hash(eltt_block *block);
 
+/* Merkle-Wurzel über ein Transaktions-Array (Engine, Batch-Hashing) */
+void eltt_blockchain_merkle_root(const eltt_transaction *txs, size_t tx_count,
+                                 uint8_t out_root[32]);
+
+/* Header-Hash über die gespeicherten Felder (verifizierte Wurzel) */
+void eltt_blockchain_compute_block_header_hash(const eltt_block *block,
+                                               uint8_t out_hash[32]);
+
+/* O(1)-Zugriff auf Block i im segmentierten Block-Speicher der Engine */
+const eltt_block *eltt_blockchain_get_block(const eltt_blockchain *bc, size_t i);
+
+/* Generationszähler eines Teilzustands (Engine, Dirty-Tracking) */
+uint64_t eltt_blockchain_view_generation(const eltt_blockchain *bc,
+                                         eltt_view_kind kind);
+
 /* ----------------------------------------------------------
  * Fehlercodes für Validator
  * ---------------------------------------------------------- */
@@ -149,6 +232,7 @@ typedef enum {
     ELTT_VALIDATOR_ERR_BLOCK_INDEX_SEQUENCE,
     ELTT_VALIDATOR_ERR_BLOCK_PREV_HASH_MISMATCH,
     ELTT_VALIDATOR_ERR_BLOCK_HASH_MISMATCH,
+    ELTT_VALIDATOR_ERR_BLOCK_MERKLE_MISMATCH,
     ELTT_VALIDATOR_ERR_TIMESTAMP_NON_MONOTONIC,
 
     /* Token / Wallet / Pools / Stakes */
@@ -171,6 +255,47 @@ typedef enum {
     ELTT_VALIDATOR_ERR_UNKNOWN
 } eltt_validator_error;
 
+/* ----------------------------------------------------------
+ * Validator-Checkpoint für inkrementelle Prüfung
+ *
+ * Hält fest, bis wohin die Chain und die Zustands-Arrays bereits
+ * geprüft wurden. Nachfolgende inkrementelle Läufe prüfen nur noch,
+ * was seitdem hinzugekommen ist; die vollständige Prüfung
+ * (eltt_validator_check_blockchain) bleibt für Audits erhalten.
+ * ---------------------------------------------------------- */
+
+typedef struct {
+    size_t   verified_block_count;   /* Blöcke [0, n) sind geprüft */
+    uint8_t  last_hash[32];          /* Hash des letzten geprüften Blocks */
+    uint64_t last_timestamp;         /* Zeitstempel-Wasserstand */
+    size_t   verified_wallet_count;
+    size_t   verified_pool_count;
+    size_t   verified_stake_count;
+    size_t   verified_token_count;
+    /* Generationsstände der Teilzustände beim letzten erfolgreichen
+     * Lauf (für die gestufte Prüfung): stimmt der Zähler der Engine
+     * noch überein, wurde der Teilzustand seitdem nicht angefasst und
+     * seine Prüfung kann komplett entfallen. */
+    uint64_t seen_generations[ELTT_VIEW_COUNT];
+} eltt_validator_checkpoint;
+
+/* Prüfstufen für eltt_validator_check_tiered():
+ * - FAST:     nur Teilzustände, deren Generationszähler sich seit dem
+ *             Checkpoint bewegt hat (Wallets/Pools/Stakes/Token);
+ *             kein Block-Hashing. Gedacht als Mikrosekunden-Check
+ *             nach jedem Append.
+ * - STANDARD: FAST plus Verkettungs- und Hash-Prüfung der seit dem
+ *             Checkpoint neu hinzugekommenen Blöcke.
+ * - FULL:     vollständige Prüfung wie eltt_validator_check_blockchain()
+ *             (geplante Audits); der Checkpoint wird danach auf den
+ *             aktuellen Stand gesetzt.
+ */
+typedef enum {
+    ELTT_VALIDATOR_TIER_FAST = 0,
+    ELTT_VALIDATOR_TIER_STANDARD,
+    ELTT_VALIDATOR_TIER_FULL
+} eltt_validator_tier;
+
 /* ----------------------------------------------------------
  * Interne Hilfsfunktionen (static)
  * ---------------------------------------------------------- */
@@ -208,21 +333,23 @@ static int eltt_validator_check_token_symbols_unique(const eltt_blockchain *bc)
     return 1;
 }
 
-static int eltt_validator_check_wallets(const eltt_blockchain *bc,
-                                        eltt_validator_error *out_err)
+static int eltt_validator_check_wallets_from(const eltt_blockchain *bc,
+                                             size_t start,
+                                             eltt_validator_error *out_err)
 {
-    for (size_t i = 0; i < bc->wallet_count; ++i) {
-        const eltt_wallet *w = &bc->wallets[i];
-        if (!eltt_validator_is_address_valid(w->address)) {
+    for (size_t i = start; i < bc->wallet_count; ++i) {
+        if (!eltt_validator_is_address_valid(bc->wallets[i].address)) {
             if (out_err) *out_err = ELTT_VALIDATOR_ERR_WALLET_ADDRESS_INVALID;
             return 0;
         }
-        if (w->token_count > bc->token_count) {
-            if (out_err) *out_err = ELTT_VALIDATOR_ERR_TX_TOKEN_INDEX_INVALID;
-            return 0;
-        }
-        for (size_t t = 0; t < w->token_count; ++t) {
-            if (w->balances[t] < 0.0) {
+    }
+    /* Guthaben-Scan token-major: pro Token läuft die Prüfung über
+     * zusammenhängende Festkomma-int64 (Struct-of-Arrays-Anordnung),
+     * der Vorzeichentest ist damit exakt. */
+    for (size_t t = 0; t < bc->token_count; ++t) {
+        const eltt_amount_fp *row = bc->wallet_balances[t];
+        for (size_t i = start; i < bc->wallet_count; ++i) {
+            if (row[i] < 0) {
                 if (out_err) *out_err = ELTT_VALIDATOR_ERR_WALLET_BALANCE_NEGATIVE;
                 return 0;
             }
@@ -231,10 +358,11 @@ static int eltt_validator_check_wallets(const eltt_blockchain *bc,
     return 1;
 }
 
-static int eltt_validator_check_pools(const eltt_blockchain *bc,
-                                      eltt_validator_error *out_err)
+static int eltt_validator_check_pools_from(const eltt_blockchain *bc,
+                                           size_t start,
+                                           eltt_validator_error *out_err)
 {
-    for (size_t i = 0; i < bc->pool_count; ++i) {
+    for (size_t i = start; i < bc->pool_count; ++i) {
         const eltt_liquidity_pool *p = &bc->pools[i];
         if (p->token_x_index < 0 || (size_t)p->token_x_index >= bc->token_count) {
             if (out_err) *out_err = ELTT_VALIDATOR_ERR_POOL_INDEX_INVALID;
@@ -256,10 +384,11 @@ static int eltt_validator_check_pools(const eltt_blockchain *bc,
     return 1;
 }
 
-static int eltt_validator_check_stakes(const eltt_blockchain *bc,
-                                       eltt_validator_error *out_err)
+static int eltt_validator_check_stakes_from(const eltt_blockchain *bc,
+                                            size_t start,
+                                            eltt_validator_error *out_err)
 {
-    for (size_t i = 0; i < bc->stake_count; ++i) {
+    for (size_t i = start; i < bc->stake_count; ++i) {
         const eltt_staking_position *s = &bc->stakes[i];
         if (!eltt_validator_is_address_valid(s->owner)) {
             if (out_err) *out_err = ELTT_VALIDATOR_ERR_STAKE_OWNER_INVALID;
@@ -378,18 +507,22 @@ static int eltt_validator_check_block_transactions(const eltt_blockchain *bc,
     return 1;
 }
 
-static int eltt_validator_check_chain(const eltt_blockchain *bc,
-                                      eltt_validator_error *out_err)
+/* Prüft die Blöcke [start, block_count). Bei start > 0 wird der erste
+ * neue Block gegen expected_prev_hash und last_ts aus dem Checkpoint
+ * verkettet statt gegen den (bereits geprüften) Vorgänger im Speicher. */
+static int eltt_validator_check_chain_from(const eltt_blockchain *bc,
+                                           size_t start,
+                                           const uint8_t *expected_prev_hash,
+                                           uint64_t last_ts,
+                                           eltt_validator_error *out_err)
 {
     if (bc->block_count == 0) {
         if (out_err) *out_err = ELTT_VALIDATOR_ERR_NO_BLOCKS;
         return 0;
     }
 
-    uint64_t last_ts = 0;
-
-    for (size_t i = 0; i < bc->block_count; ++i) {
-        const eltt_block *blk = &bc->blocks[i];
+    for (size_t i = start; i < bc->block_count; ++i) {
+        const eltt_block *blk = eltt_blockchain_get_block(bc, i);
 
         /* Genesis-Block */
         if (i == 0) {
@@ -400,21 +533,36 @@ static int eltt_validator_check_chain(const eltt_blockchain *bc,
                 return 0;
             }
         } else {
-            const eltt_block *prev = &bc->blocks[i - 1];
-            if (blk->index != prev->index + 1) {
+            const uint8_t *prev_hash;
+            uint32_t prev_index;
+            if (i == start && expected_prev_hash) {
+                prev_hash = expected_prev_hash;
+                prev_index = (uint32_t)(start - 1);
+            } else {
+                const eltt_block *prev = eltt_blockchain_get_block(bc, i - 1);
+                prev_hash = prev->hash;
+                prev_index = prev->index;
+            }
+            if (blk->index != prev_index + 1) {
                 if (out_err) *out_err = ELTT_VALIDATOR_ERR_BLOCK_INDEX_SEQUENCE;
                 return 0;
             }
-            if (memcmp(blk->prev_hash, prev->hash, 32) != 0) {
+            if (memcmp(blk->prev_hash, prev_hash, 32) != 0) {
                 if (out_err) *out_err = ELTT_VALIDATOR_ERR_BLOCK_PREV_HASH_MISMATCH;
                 return 0;
             }
         }
 
-        /* Hash-Konsistenz prüfen */
-        eltt_block tmp = *blk;
-        eltt_blockchain_compute_block_hash(&tmp);
-        if (memcmp(tmp.hash, blk->hash, 32) != 0) {
+        /* Merkle-Commitment und Hash-Konsistenz prüfen */
+        uint8_t root[32];
+        eltt_blockchain_merkle_root(blk->txs, blk->tx_count, root);
+        if (memcmp(root, blk->merkle_root, 32) != 0) {
+            if (out_err) *out_err = ELTT_VALIDATOR_ERR_BLOCK_MERKLE_MISMATCH;
+            return 0;
+        }
+        uint8_t expected[32];
+        eltt_blockchain_compute_block_header_hash(blk, expected);
+        if (memcmp(expected, blk->hash, 32) != 0) {
             if (out_err) *out_err = ELTT_VALIDATOR_ERR_BLOCK_HASH_MISMATCH;
             return 0;
         }
@@ -469,24 +617,419 @@ int eltt_validator_check_blockchain(const eltt_blockchain *bc,
     }
 
     /* Wallets prüfen */
-    if (!eltt_validator_check_wallets(bc, out_err)) {
+    if (!eltt_validator_check_wallets_from(bc, 0, out_err)) {
         return 0;
     }
 
     /* Pools prüfen */
-    if (!eltt_validator_check_pools(bc, out_err)) {
+    if (!eltt_validator_check_pools_from(bc, 0, out_err)) {
         return 0;
     }
 
     /* Stakes prüfen */
-    if (!eltt_validator_check_stakes(bc, out_err)) {
+    if (!eltt_validator_check_stakes_from(bc, 0, out_err)) {
         return 0;
     }
 
     /* Chain (Blöcke, Hashes, Timestamps, TXs) prüfen */
-    if (!eltt_validator_check_chain(bc, out_err)) {
+    if (!eltt_validator_check_chain_from(bc, 0, NULL, 0, out_err)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/* ----------------------------------------------------------
+ * Parallele Chain-Prüfung
+ *
+ * Die Verkettung (prev_hash, Index-Sequenz, Zeitstempel) ist billig
+ * und wird seriell geprüft. Das teure Re-Hashing der Blöcke und die
+ * Transaktions-Prüfung sind pro Block unabhängig und werden danach
+ * über Worker-Threads verteilt (Stride-Partitionierung).
+ * ---------------------------------------------------------- */
+
+typedef struct {
+    const eltt_blockchain *bc;
+    size_t start;
+    size_t stride;
+    int ok;
+    eltt_validator_error err;
+} eltt_validator_hash_worker_ctx;
+
+static void *eltt_validator_hash_worker(void *arg)
+{
+    eltt_validator_hash_worker_ctx *ctx = (eltt_validator_hash_worker_ctx *)arg;
+    for (size_t i = ctx->start; i < ctx->bc->block_count; i += ctx->stride) {
+        const eltt_block *blk = eltt_blockchain_get_block(ctx->bc, i);
+
+        uint8_t root[32];
+        eltt_blockchain_merkle_root(blk->txs, blk->tx_count, root);
+        if (memcmp(root, blk->merkle_root, 32) != 0) {
+            ctx->ok = 0;
+            ctx->err = ELTT_VALIDATOR_ERR_BLOCK_MERKLE_MISMATCH;
+            return NULL;
+        }
+        uint8_t expected[32];
+        eltt_blockchain_compute_block_header_hash(blk, expected);
+        if (memcmp(expected, blk->hash, 32) != 0) {
+            ctx->ok = 0;
+            ctx->err = ELTT_VALIDATOR_ERR_BLOCK_HASH_MISMATCH;
+            return NULL;
+        }
+
+        if (!eltt_validator_check_block_transactions(ctx->bc, blk, &ctx->err)) {
+            ctx->ok = 0;
+            return NULL;
+        }
+    }
+    ctx->ok = 1;
+    return NULL;
+}
+
+/* Serieller Verkettungs-Pass ohne Re-Hashing (prev_hash, Index,
+ * Zeitstempel-Monotonie, Genesis-Sonderfall). */
+static int eltt_validator_check_chain_linkage(const eltt_blockchain *bc,
+                                              eltt_validator_error *out_err)
+{
+    if (bc->block_count == 0) {
+        if (out_err) *out_err = ELTT_VALIDATOR_ERR_NO_BLOCKS;
+        return 0;
+    }
+
+    uint64_t last_ts = 0;
+    for (size_t i = 0; i < bc->block_count; ++i) {
+        const eltt_block *blk = eltt_blockchain_get_block(bc, i);
+
+        if (i == 0) {
+            uint8_t zero[32];
+            memset(zero, 0, 32);
+            if (memcmp(blk->prev_hash, zero, 32) != 0) {
+                if (out_err) *out_err = ELTT_VALIDATOR_ERR_GENESIS_PREV_HASH;
+                return 0;
+            }
+        } else {
+            const eltt_block *prev = eltt_blockchain_get_block(bc, i - 1);
+            if (blk->index != prev->index + 1) {
+                if (out_err) *out_err = ELTT_VALIDATOR_ERR_BLOCK_INDEX_SEQUENCE;
+                return 0;
+            }
+            if (memcmp(blk->prev_hash, prev->hash, 32) != 0) {
+                if (out_err) *out_err = ELTT_VALIDATOR_ERR_BLOCK_PREV_HASH_MISMATCH;
+                return 0;
+            }
+            if (blk->timestamp < last_ts) {
+                if (out_err) *out_err = ELTT_VALIDATOR_ERR_TIMESTAMP_NON_MONOTONIC;
+                return 0;
+            }
+        }
+        last_ts = blk->timestamp;
+    }
+    return 1;
+}
+
+/* Chain-Prüfung mit num_threads Worker-Threads. num_threads <= 1 fällt
+ * auf die serielle Prüfung zurück. */
+static int eltt_validator_check_chain_parallel(const eltt_blockchain *bc,
+                                               size_t num_threads,
+                                               eltt_validator_error *out_err)
+{
+    if (num_threads <= 1 || bc->block_count < 2) {
+        return eltt_validator_check_chain_from(bc, 0, NULL, 0, out_err);
+    }
+    if (num_threads > bc->block_count) {
+        num_threads = bc->block_count;
+    }
+
+    if (!eltt_validator_check_chain_linkage(bc, out_err)) {
+        return 0;
+    }
+
+    pthread_t threads[64];
+    eltt_validator_hash_worker_ctx ctxs[64];
+    if (num_threads > 64) {
+        num_threads = 64;
+    }
+
+    size_t launched = 0;
+    for (size_t t = 0; t < num_threads; ++t) {
+        ctxs[t].bc = bc;
+        ctxs[t].start = t;
+        ctxs[t].stride = num_threads;
+        ctxs[t].ok = 0;
+        ctxs[t].err = ELTT_VALIDATOR_OK;
+        if (pthread_create(&threads[t], NULL, eltt_validator_hash_worker, &ctxs[t]) != 0) {
+            break;
+        }
+        launched++;
+    }
+
+    if (launched < num_threads) {
+        /* Thread-Start fehlgeschlagen: verbleibende Stride-Mengen seriell */
+        for (size_t t = launched; t < num_threads; ++t) {
+            eltt_validator_hash_worker(&ctxs[t]);
+        }
+    }
+
+    int ok = 1;
+    eltt_validator_error err = ELTT_VALIDATOR_OK;
+    for (size_t t = 0; t < num_threads; ++t) {
+        if (t < launched) {
+            pthread_join(threads[t], NULL);
+        }
+        if (!ctxs[t].ok && ok) {
+            ok = 0;
+            err = ctxs[t].err;
+        }
+    }
+
+    if (!ok && out_err) {
+        *out_err = err;
+    }
+    return ok;
+}
+
+/* Vollständige Prüfung wie eltt_validator_check_blockchain(), aber mit
+ * paralleler Hash-/Transaktions-Prüfung der Blöcke. Gedacht für
+ * Start-up- und Audit-Läufe auf Mehrkern-Knoten. */
+int eltt_validator_check_blockchain_parallel(const eltt_blockchain *bc,
+                                             size_t num_threads,
+                                             eltt_validator_error *out_err)
+{
+    if (out_err) {
+        *out_err = ELTT_VALIDATOR_OK;
+    }
+    if (!bc) {
+        if (out_err) *out_err = ELTT_VALIDATOR_ERR_NULL_BLOCKCHAIN;
+        return 0;
+    }
+
+    if (!eltt_validator_check_token_symbols_unique(bc)) {
+        if (out_err) *out_err = ELTT_VALIDATOR_ERR_TOKEN_SYMBOL_DUPLICATE;
+        return 0;
+    }
+    if (!eltt_validator_check_wallets_from(bc, 0, out_err)) {
+        return 0;
+    }
+    if (!eltt_validator_check_pools_from(bc, 0, out_err)) {
+        return 0;
+    }
+    if (!eltt_validator_check_stakes_from(bc, 0, out_err)) {
+        return 0;
+    }
+
+    return eltt_validator_check_chain_parallel(bc, num_threads, out_err);
+}
+
+/* ----------------------------------------------------------
+ * Inkrementelle Prüfung über Checkpoints
+ * ---------------------------------------------------------- */
+
+/* Setzt einen Checkpoint auf den Anfangszustand (noch nichts geprüft). */
+void eltt_validator_checkpoint_init(eltt_validator_checkpoint *cp)
+{
+    memset(cp, 0, sizeof(*cp));
+}
+
+/* Verankert einen Checkpoint an einem Zustands-Snapshot der Engine
+ * (Höhe und Block-Hash aus eltt_blockchain_snapshot_info bzw. dem
+ * Restore-Pfad): Blöcke unterhalb der Snapshot-Höhe gelten als
+ * geprüft, der nächste inkrementelle Lauf beginnt dahinter. Die
+ * Zustands-Arrays werden bewusst nicht übersprungen — deren Prüfung
+ * ist strukturell und billig. Gibt 0 zurück, wenn der Block an der
+ * Snapshot-Höhe fehlt oder nicht zum Hash passt. */
+int eltt_validator_checkpoint_anchor(eltt_validator_checkpoint *cp,
+                                     const eltt_blockchain *bc,
+                                     size_t block_count,
+                                     const uint8_t block_hash[32])
+{
+    eltt_validator_checkpoint_init(cp);
+    if (!bc || block_count == 0 || block_count > bc->block_count) {
+        return 0;
+    }
+    const eltt_block *anchor = eltt_blockchain_get_block(bc, block_count - 1);
+    if (memcmp(anchor->hash, block_hash, 32) != 0) {
+        return 0;
+    }
+    cp->verified_block_count = block_count;
+    memcpy(cp->last_hash, anchor->hash, 32);
+    cp->last_timestamp = anchor->timestamp;
+    return 1;
+}
+
+/* Prüft nur, was seit dem Checkpoint hinzugekommen ist: neue Blöcke
+ * (verkettet gegen den gemerkten Hash und Zeitstempel-Wasserstand)
+ * sowie neu angelegte Wallets, Pools, Stakes und Token-Symbole.
+ * Bei Erfolg wird der Checkpoint fortgeschrieben. Für vollständige
+ * Audits bleibt eltt_validator_check_blockchain() zuständig.
+ */
+int eltt_validator_check_blockchain_incremental(const eltt_blockchain *bc,
+                                                eltt_validator_checkpoint *cp,
+                                                eltt_validator_error *out_err)
+{
+    if (out_err) {
+        *out_err = ELTT_VALIDATOR_OK;
+    }
+    if (!bc) {
+        if (out_err) *out_err = ELTT_VALIDATOR_ERR_NULL_BLOCKCHAIN;
+        return 0;
+    }
+    if (!cp) {
+        return eltt_validator_check_blockchain(bc, out_err);
+    }
+
+    if (cp->verified_token_count < bc->token_count) {
+        if (!eltt_validator_check_token_symbols_unique(bc)) {
+            if (out_err) *out_err = ELTT_VALIDATOR_ERR_TOKEN_SYMBOL_DUPLICATE;
+            return 0;
+        }
+    }
+
+    if (!eltt_validator_check_wallets_from(bc, cp->verified_wallet_count, out_err)) {
+        return 0;
+    }
+    if (!eltt_validator_check_pools_from(bc, cp->verified_pool_count, out_err)) {
+        return 0;
+    }
+    if (!eltt_validator_check_stakes_from(bc, cp->verified_stake_count, out_err)) {
+        return 0;
+    }
+
+    if (cp->verified_block_count < bc->block_count) {
+        const uint8_t *prev = (cp->verified_block_count > 0) ? cp->last_hash : NULL;
+        if (!eltt_validator_check_chain_from(bc,
+                                             cp->verified_block_count,
+                                             prev,
+                                             cp->last_timestamp,
+                                             out_err)) {
+            return 0;
+        }
+    }
+
+    /* Checkpoint fortschreiben */
+    cp->verified_block_count = bc->block_count;
+    if (bc->block_count > 0) {
+        const eltt_block *tip = eltt_blockchain_get_block(bc, bc->block_count - 1);
+        memcpy(cp->last_hash, tip->hash, 32);
+        cp->last_timestamp = tip->timestamp;
+    }
+    cp->verified_wallet_count = bc->wallet_count;
+    cp->verified_pool_count = bc->pool_count;
+    cp->verified_stake_count = bc->stake_count;
+    cp->verified_token_count = bc->token_count;
+
+    return 1;
+}
+
+/* ----------------------------------------------------------
+ * Gestufte Prüfung über Generationszähler
+ *
+ * Die Engine zählt pro Teilzustand (Chain, Wallets, Pools, Stakes)
+ * eine Generation hoch, sobald sie ihn mutiert. Der Checkpoint merkt
+ * sich die zuletzt geprüften Stände; unveränderte Teilzustände werden
+ * hier komplett übersprungen. Da die Zähler nur Teilzustands- und
+ * nicht Eintrags-Granularität haben und Guthaben, Reserven und
+ * Stake-Beträge in place mutieren, wird ein als schmutzig erkannter
+ * Teilzustand vollständig neu gescannt — diese Scans sind strukturell
+ * und billig (int64-Vorzeichen, Bereichs- und Formprüfungen), das
+ * teure Block-Re-Hashing bleibt den Stufen STANDARD/FULL vorbehalten.
+ * ---------------------------------------------------------- */
+
+int eltt_validator_check_tiered(const eltt_blockchain *bc,
+                                eltt_validator_tier tier,
+                                eltt_validator_checkpoint *cp,
+                                eltt_validator_error *out_err)
+{
+    if (out_err) {
+        *out_err = ELTT_VALIDATOR_OK;
+    }
+    if (!bc) {
+        if (out_err) *out_err = ELTT_VALIDATOR_ERR_NULL_BLOCKCHAIN;
         return 0;
     }
+    if (!cp || tier == ELTT_VALIDATOR_TIER_FULL) {
+        if (!eltt_validator_check_blockchain(bc, out_err)) {
+            return 0;
+        }
+        if (cp) {
+            /* Checkpoint auf den vollständig geprüften Stand setzen */
+            cp->verified_block_count = bc->block_count;
+            if (bc->block_count > 0) {
+                const eltt_block *tip =
+                    eltt_blockchain_get_block(bc, bc->block_count - 1);
+                memcpy(cp->last_hash, tip->hash, 32);
+                cp->last_timestamp = tip->timestamp;
+            }
+            cp->verified_wallet_count = bc->wallet_count;
+            cp->verified_pool_count = bc->pool_count;
+            cp->verified_stake_count = bc->stake_count;
+            cp->verified_token_count = bc->token_count;
+            for (int k = 0; k < ELTT_VIEW_COUNT; ++k) {
+                cp->seen_generations[k] =
+                    eltt_blockchain_view_generation(bc, (eltt_view_kind)k);
+            }
+        }
+        return 1;
+    }
+
+    uint64_t gen_wallets = eltt_blockchain_view_generation(bc, ELTT_VIEW_WALLETS);
+    uint64_t gen_pools = eltt_blockchain_view_generation(bc, ELTT_VIEW_POOLS);
+    uint64_t gen_stakes = eltt_blockchain_view_generation(bc, ELTT_VIEW_STAKES);
+    uint64_t gen_chain = eltt_blockchain_view_generation(bc, ELTT_VIEW_CHAIN);
+
+    /* Token-Symbole: kein eigener Generationszähler, aber Token werden
+     * nur angehängt — die Zählung selbst ist der Dirty-Indikator. */
+    if (cp->verified_token_count < bc->token_count) {
+        if (!eltt_validator_check_token_symbols_unique(bc)) {
+            if (out_err) *out_err = ELTT_VALIDATOR_ERR_TOKEN_SYMBOL_DUPLICATE;
+            return 0;
+        }
+    }
+
+    if (cp->seen_generations[ELTT_VIEW_WALLETS] != gen_wallets) {
+        if (!eltt_validator_check_wallets_from(bc, 0, out_err)) {
+            return 0;
+        }
+    }
+    if (cp->seen_generations[ELTT_VIEW_POOLS] != gen_pools) {
+        if (!eltt_validator_check_pools_from(bc, 0, out_err)) {
+            return 0;
+        }
+    }
+    if (cp->seen_generations[ELTT_VIEW_STAKES] != gen_stakes) {
+        if (!eltt_validator_check_stakes_from(bc, 0, out_err)) {
+            return 0;
+        }
+    }
+
+    /* Neue Blöcke: nur ab STANDARD; FAST lässt den Block-Wasserstand
+     * des Checkpoints unangetastet, damit ein späterer STANDARD-Lauf
+     * die ausgelassenen Blöcke nachholt. */
+    if (tier == ELTT_VALIDATOR_TIER_STANDARD &&
+        cp->verified_block_count < bc->block_count) {
+        const uint8_t *prev = (cp->verified_block_count > 0) ? cp->last_hash : NULL;
+        if (!eltt_validator_check_chain_from(bc,
+                                             cp->verified_block_count,
+                                             prev,
+                                             cp->last_timestamp,
+                                             out_err)) {
+            return 0;
+        }
+        cp->verified_block_count = bc->block_count;
+        const eltt_block *tip = eltt_blockchain_get_block(bc, bc->block_count - 1);
+        memcpy(cp->last_hash, tip->hash, 32);
+        cp->last_timestamp = tip->timestamp;
+    }
+    if (tier == ELTT_VALIDATOR_TIER_STANDARD) {
+        cp->seen_generations[ELTT_VIEW_CHAIN] = gen_chain;
+    }
+
+    cp->seen_generations[ELTT_VIEW_WALLETS] = gen_wallets;
+    cp->seen_generations[ELTT_VIEW_POOLS] = gen_pools;
+    cp->seen_generations[ELTT_VIEW_STAKES] = gen_stakes;
+    cp->verified_wallet_count = bc->wallet_count;
+    cp->verified_pool_count = bc->pool_count;
+    cp->verified_stake_count = bc->stake_count;
+    cp->verified_token_count = bc->token_count;
 
     return 1;
 }
@@ -17,6 +17,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 /* ----------------------------------------------------------
  * Gemeinsame Typen (müssen mit ELTT-Blockchain.c übereinstimmen)
@@ -31,6 +32,16 @@
 #define ELTT_MAX_WALLETS          1024
 #define ELTT_MAX_POOLS            256
 #define ELTT_MAX_STAKES           1024
+#define ELTT_WALLET_INDEX_CAP     2048
+#define ELTT_INTERN_MAX_IDS       16384
+
+/* Festkomma-Guthaben: muss mit ELTT-Blockchain.c übereinstimmen. */
+typedef int64_t eltt_amount_fp;
+#define ELTT_FP_SCALE 100000000LL
+#define ELTT_BLOCKS_PER_CHUNK     64
+#define ELTT_MAX_BLOCK_CHUNKS     8192
+#define ELTT_TX_CHUNK_CAP         4096
+#define ELTT_MAX_TX_CHUNKS        4096
 
 typedef enum {
     ELTT_TOKEN_KIND_TTTC,
@@ -50,9 +61,6 @@ typedef struct {
 
 typedef struct {
     char  address[ELTT_MAX_ADDRESS_LEN];
-    size_t token_count;
-    eltt_token_type tokens[ELTT_MAX_TOKEN_TYPES];
-    double balances[ELTT_MAX_TOKEN_TYPES];
 } eltt_wallet;
 
 typedef enum {
@@ -78,6 +86,10 @@ typedef struct {
     int   token_index;
     eltt_tx_kind kind;
     char  memo[ELTT_MAX_MEMO_LEN];
+    /* Interning-Cache (siehe ELTT-Blockchain.c): prozess-lokal,
+     * nicht Teil des Wire-Formats; 0 = nicht interniert. */
+    uint32_t from_id;
+    uint32_t to_id;
 } eltt_transaction;
 
 typedef struct {
@@ -85,8 +97,10 @@ typedef struct {
     uint64_t timestamp;
     uint8_t  prev_hash[32];
     uint8_t  hash[32];
+    /* Merkle-Wurzel über die serialisierten Transaktionen des Blocks */
+    uint8_t  merkle_root[32];
     size_t   tx_count;
-    eltt_transaction txs[ELTT_MAX_TX_PER_BLOCK];
+    eltt_transaction *txs;
 } eltt_block;
 
 typedef struct {
@@ -104,19 +118,73 @@ typedef struct {
     uint64_t start_timestamp;
     uint64_t lock_until;
     double accumulated_rewards;
+    /* Akkumulator-Snapshot, siehe ELTT-Blockchain.c */
+    double reward_per_token_snap;
 } eltt_staking_position;
 
+/* Teilzustände mit eigenem Generationszähler (muss mit
+ * ELTT-Blockchain.c übereinstimmen). */
+typedef enum {
+    ELTT_VIEW_CHAIN = 0,
+    ELTT_VIEW_WALLETS,
+    ELTT_VIEW_POOLS,
+    ELTT_VIEW_STAKES,
+    ELTT_VIEW_COUNT
+} eltt_view_kind;
+
+/* Materialisierte Pool-Ansicht (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    int pool_index;
+    int token_x_index;
+    int token_y_index;
+    double reserve_x;
+    double reserve_y;
+    int lp_token_index;
+} eltt_pool_view_entry;
+
+/* Posting-Liste für Wallet-Aktivität
+ * (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    uint32_t block_index;
+    uint32_t tx_index;
+} eltt_tx_ref;
+
+typedef struct {
+    size_t count;
+    size_t cap;
+    eltt_tx_ref *refs;
+} eltt_activity_list;
+
 typedef struct {
     size_t block_count;
-    eltt_block *blocks;
+    eltt_block *block_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    uint8_t *bloom_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    size_t tx_chunk_count;
+    size_t tx_chunk_used;
+    eltt_transaction *tx_chunks[ELTT_MAX_TX_CHUNKS];
     size_t wallet_count;
     eltt_wallet wallets[ELTT_MAX_WALLETS];
+    /* Guthaben token-major (Struct-of-Arrays), siehe ELTT-Blockchain.c */
+    eltt_amount_fp wallet_balances[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_WALLETS];
     size_t token_count;
     eltt_token_type token_types[ELTT_MAX_TOKEN_TYPES];
     size_t pool_count;
     eltt_liquidity_pool pools[ELTT_MAX_POOLS];
     size_t stake_count;
     eltt_staking_position stakes[ELTT_MAX_STAKES];
+    /* Staking-Reward-Akkumulatoren, siehe ELTT-Blockchain.c */
+    double   stake_reward_per_token[ELTT_MAX_TOKEN_TYPES];
+    uint64_t stake_accrual_timestamp;
+    int32_t wallet_index_map[ELTT_WALLET_INDEX_CAP];
+    /* Direkt-Map Intern-ID -> Wallet-Index, siehe ELTT-Blockchain.c */
+    int32_t id_to_wallet[ELTT_INTERN_MAX_IDS + 1];
+    /* Generationszähler und materialisierte Pool-Ansicht,
+     * siehe ELTT-Blockchain.c */
+    uint64_t view_generations[ELTT_VIEW_COUNT];
+    size_t pool_view_count;
+    eltt_pool_view_entry pool_view[ELTT_MAX_POOLS];
+    /* Aktivitäts-Index, siehe ELTT-Blockchain.c */
+    eltt_activity_list activity[ELTT_MAX_WALLETS];
 } eltt_blockchain;
 
 /* ----------------------------------------------------------
@@ -156,15 +224,6 @@ typedef struct {
     double energy_value;
 } eltt_staking_view_entry;
 
-typedef struct {
-    int pool_index;
-    int token_x_index;
-    int token_y_index;
-    double reserve_x;
-    double reserve_y;
-    int lp_token_index;
-} eltt_pool_view_entry;
-
 typedef struct {
     size_t tx_index;
     uint32_t block_index;
@@ -181,18 +240,48 @@ extern "C" {
 
 double eltt_blockchain_compute_tx_energy(const eltt_transaction *tx);
 
+/* O(1)-Wallet-Lookup über den Adress-Index der Engine */
+int eltt_blockchain_find_wallet(const eltt_blockchain *bc, const char *address);
+
+/* O(1)-Zugriff auf Block i im segmentierten Block-Speicher der Engine */
+const eltt_block *eltt_blockchain_get_block(const eltt_blockchain *bc, size_t i);
+
+/* Generationszähler eines Teilzustands (siehe eltt_view_kind) */
+uint64_t eltt_blockchain_view_generation(const eltt_blockchain *bc,
+                                         eltt_view_kind kind);
+
+/* Ausstehende Staking-Rewards einer Position (O(1), Akkumulator) */
+double eltt_blockchain_stake_pending(const eltt_blockchain *bc,
+                                     size_t stake_index);
+
+/* Aktivitätsabfragen über den Posting-Listen-Index der Engine */
+size_t eltt_blockchain_wallet_activity_count(const eltt_blockchain *bc,
+                                             const char *address);
+size_t eltt_blockchain_wallet_activity(const eltt_blockchain *bc,
+                                       const char *address,
+                                       size_t offset,
+                                       size_t max_entries,
+                                       eltt_transaction *out_txs,
+                                       uint32_t *out_block_indices);
+
+/* Bloom-geführter Ad-hoc-Scan für Adressen ohne Wallet-Index-Eintrag */
+size_t eltt_blockchain_scan_address_txs(const eltt_blockchain *bc,
+                                        const char *address,
+                                        size_t offset,
+                                        size_t max_entries,
+                                        eltt_transaction *out_txs,
+                                        uint32_t *out_block_indices);
+
+/* Instrumentierungs-Hook der Engine (zählt Viewer-Builds) */
+void eltt_stats_note_viewer_build(void);
+
 /* ----------------------------------------------------------
  * Interne Hilfsfunktionen
  * ---------------------------------------------------------- */
 
 static int eltt_viewer_find_wallet_index(const eltt_blockchain *bc, const char *address)
 {
-    for (size_t i = 0; i < bc->wallet_count; ++i) {
-        if (strcmp(bc->wallets[i].address, address) == 0) {
-            return (int)i;
-        }
-    }
-    return -1;
+    return eltt_blockchain_find_wallet(bc, address);
 }
 
 /* ----------------------------------------------------------
@@ -203,9 +292,10 @@ size_t eltt_viewer_build_chain_grid(const eltt_blockchain *bc,
                                     eltt_chain_grid_entry *out_entries,
                                     size_t max_entries)
 {
+    eltt_stats_note_viewer_build();
     size_t count = (bc->block_count < max_entries) ? bc->block_count : max_entries;
     for (size_t i = 0; i < count; ++i) {
-        const eltt_block *b = &bc->blocks[i];
+        const eltt_block *b = eltt_blockchain_get_block(bc, i);
         eltt_chain_grid_entry *e = &out_entries[i];
         e->index = b->index;
         e->timestamp = b->timestamp;
@@ -225,17 +315,16 @@ size_t eltt_viewer_build_token_positions(const eltt_blockchain *bc,
                                          eltt_token_position *out_positions,
                                          size_t max_positions)
 {
+    eltt_stats_note_viewer_build();
     int widx = eltt_viewer_find_wallet_index(bc, wallet_address);
     if (widx < 0) {
         return 0;
     }
-    const eltt_wallet *w = &bc->wallets[widx];
-
-    size_t count = (w->token_count < max_positions) ? w->token_count : max_positions;
+    size_t count = (bc->token_count < max_positions) ? bc->token_count : max_positions;
     for (size_t i = 0; i < count; ++i) {
         eltt_token_position *p = &out_positions[i];
         p->token_index = (int)i;
-        p->balance = w->balances[i];
+        p->balance = (double)bc->wallet_balances[i][widx] / (double)ELTT_FP_SCALE;
         p->energy_value = 0.0;
     }
     return count;
@@ -250,20 +339,20 @@ size_t eltt_viewer_build_lp_positions(const eltt_blockchain *bc,
                                       eltt_lp_position *out_positions,
                                       size_t max_positions)
 {
+    eltt_stats_note_viewer_build();
     int widx = eltt_viewer_find_wallet_index(bc, wallet_address);
     if (widx < 0) {
         return 0;
     }
-    const eltt_wallet *w = &bc->wallets[widx];
-
     size_t out_count = 0;
     for (size_t p = 0; p < bc->pool_count && out_count < max_positions; ++p) {
         const eltt_liquidity_pool *pool = &bc->pools[p];
         int lp_idx = pool->lp_token_index;
-        if (lp_idx < 0 || (size_t)lp_idx >= w->token_count) {
+        if (lp_idx < 0 || (size_t)lp_idx >= bc->token_count) {
             continue;
         }
-        double lp_balance = w->balances[lp_idx];
+        double lp_balance =
+            (double)bc->wallet_balances[lp_idx][widx] / (double)ELTT_FP_SCALE;
         if (lp_balance <= 0.0) {
             continue;
         }
@@ -292,6 +381,7 @@ size_t eltt_viewer_build_staking_view(const eltt_blockchain *bc,
                                       eltt_staking_view_entry *out_entries,
                                       size_t max_entries)
 {
+    eltt_stats_note_viewer_build();
     size_t out_count = 0;
     for (size_t i = 0; i < bc->stake_count && out_count < max_entries; ++i) {
         const eltt_staking_position *s = &bc->stakes[i];
@@ -304,7 +394,10 @@ size_t eltt_viewer_build_staking_view(const eltt_blockchain *bc,
         e->amount = s->amount;
         e->start_timestamp = s->start_timestamp;
         e->lock_until = s->lock_until;
-        e->accumulated_rewards = s->accumulated_rewards;
+        /* Festgeschriebene plus noch nicht festgeschriebene Rewards —
+         * letztere liefert die Engine per Akkumulator-Vergleich. */
+        e->accumulated_rewards = s->accumulated_rewards +
+                                 eltt_blockchain_stake_pending(bc, i);
         e->energy_value = 0.0;
     }
     return out_count;
@@ -318,6 +411,7 @@ size_t eltt_viewer_build_pool_view(const eltt_blockchain *bc,
                                    eltt_pool_view_entry *out_entries,
                                    size_t max_entries)
 {
+    eltt_stats_note_viewer_build();
     size_t count = (bc->pool_count < max_entries) ? bc->pool_count : max_entries;
     for (size_t i = 0; i < count; ++i) {
         const eltt_liquidity_pool *p = &bc->pools[i];
@@ -332,6 +426,144 @@ size_t eltt_viewer_build_pool_view(const eltt_blockchain *bc,
     return count;
 }
 
+/* ----------------------------------------------------------
+ * Delta-Varianten der Ansichten
+ *
+ * Jede Variante vergleicht den Generationszähler des zugehörigen
+ * Teilzustands mit dem vom Aufrufer gemerkten Stand (*seen_generation).
+ * Ist er unverändert, wird weder gebaut noch serialisiert: Rückgabe 0
+ * und *out_changed = 0. Bei Änderung wird *seen_generation fortge-
+ * schrieben und die Ansicht wie gewohnt gebaut. Pro Poll-Zyklus kostet
+ * eine unveränderte Ansicht damit genau einen Vergleich.
+ * ---------------------------------------------------------- */
+
+/* Cursor-/Delta-Abfrage des Chain-Grids: *cursor ist die Zahl der vom
+ * Aufrufer bereits empfangenen Zellen. Bei unveränderter CHAIN-
+ * Generation wird nichts kopiert; andernfalls werden nur die Zellen ab
+ * *cursor geliefert und der Cursor fortgeschrieben. Läuft die Chain dem
+ * Puffer davon, holt der nächste Aufruf den Rest nach (die Generation
+ * wird erst fortgeschrieben, wenn der Cursor aufgeschlossen hat). */
+size_t eltt_viewer_build_chain_grid_delta(const eltt_blockchain *bc,
+                                          uint64_t *seen_generation,
+                                          size_t *cursor,
+                                          eltt_chain_grid_entry *out_entries,
+                                          size_t max_entries,
+                                          int *out_changed)
+{
+    uint64_t gen = eltt_blockchain_view_generation(bc, ELTT_VIEW_CHAIN);
+    size_t from = cursor ? *cursor : 0;
+    if (seen_generation && *seen_generation == gen && from >= bc->block_count) {
+        if (out_changed) *out_changed = 0;
+        return 0;
+    }
+    if (out_changed) *out_changed = 1;
+    if (from > bc->block_count) {
+        from = bc->block_count;
+    }
+
+    eltt_stats_note_viewer_build();
+    size_t remaining = bc->block_count - from;
+    size_t count = (remaining < max_entries) ? remaining : max_entries;
+    for (size_t i = 0; i < count; ++i) {
+        const eltt_block *b = eltt_blockchain_get_block(bc, from + i);
+        eltt_chain_grid_entry *e = &out_entries[i];
+        e->index = b->index;
+        e->timestamp = b->timestamp;
+        memcpy(e->hash, b->hash, 32);
+        memcpy(e->prev_hash, b->prev_hash, 32);
+        e->tx_count = b->tx_count;
+    }
+    if (cursor) {
+        *cursor = from + count;
+    }
+    if (seen_generation && from + count >= bc->block_count) {
+        *seen_generation = gen;
+    }
+    return count;
+}
+
+size_t eltt_viewer_build_token_positions_delta(const eltt_blockchain *bc,
+                                               const char *wallet_address,
+                                               uint64_t *seen_generation,
+                                               eltt_token_position *out_positions,
+                                               size_t max_positions,
+                                               int *out_changed)
+{
+    uint64_t gen = eltt_blockchain_view_generation(bc, ELTT_VIEW_WALLETS);
+    if (seen_generation && *seen_generation == gen) {
+        if (out_changed) *out_changed = 0;
+        return 0;
+    }
+    if (seen_generation) *seen_generation = gen;
+    if (out_changed) *out_changed = 1;
+    return eltt_viewer_build_token_positions(bc, wallet_address,
+                                             out_positions, max_positions);
+}
+
+size_t eltt_viewer_build_lp_positions_delta(const eltt_blockchain *bc,
+                                            const char *wallet_address,
+                                            uint64_t *seen_generation,
+                                            eltt_lp_position *out_positions,
+                                            size_t max_positions,
+                                            int *out_changed)
+{
+    /* LP-Positionen hängen von Guthaben und Pools ab; als Schlüssel
+     * dient die Summe beider Generationen. */
+    uint64_t gen = eltt_blockchain_view_generation(bc, ELTT_VIEW_WALLETS) +
+                   eltt_blockchain_view_generation(bc, ELTT_VIEW_POOLS);
+    if (seen_generation && *seen_generation == gen) {
+        if (out_changed) *out_changed = 0;
+        return 0;
+    }
+    if (seen_generation) *seen_generation = gen;
+    if (out_changed) *out_changed = 1;
+    return eltt_viewer_build_lp_positions(bc, wallet_address,
+                                          out_positions, max_positions);
+}
+
+size_t eltt_viewer_build_staking_view_delta(const eltt_blockchain *bc,
+                                            const char *wallet_address,
+                                            uint64_t *seen_generation,
+                                            eltt_staking_view_entry *out_entries,
+                                            size_t max_entries,
+                                            int *out_changed)
+{
+    uint64_t gen = eltt_blockchain_view_generation(bc, ELTT_VIEW_STAKES);
+    if (seen_generation && *seen_generation == gen) {
+        if (out_changed) *out_changed = 0;
+        return 0;
+    }
+    if (seen_generation) *seen_generation = gen;
+    if (out_changed) *out_changed = 1;
+    return eltt_viewer_build_staking_view(bc, wallet_address,
+                                          out_entries, max_entries);
+}
+
+size_t eltt_viewer_build_pool_view_delta(const eltt_blockchain *bc,
+                                         uint64_t *seen_generation,
+                                         eltt_pool_view_entry *out_entries,
+                                         size_t max_entries,
+                                         int *out_changed)
+{
+    uint64_t gen = eltt_blockchain_view_generation(bc, ELTT_VIEW_POOLS);
+    if (seen_generation && *seen_generation == gen) {
+        if (out_changed) *out_changed = 0;
+        return 0;
+    }
+    if (seen_generation) *seen_generation = gen;
+    if (out_changed) *out_changed = 1;
+
+    /* Die Engine pflegt die Pool-Ansicht materialisiert; solange sie
+     * vollständig ist, genügt ein memcpy statt eines Neuaufbaus. */
+    if (bc->pool_view_count == bc->pool_count) {
+        size_t count = (bc->pool_view_count < max_entries)
+                           ? bc->pool_view_count : max_entries;
+        memcpy(out_entries, bc->pool_view, count * sizeof(*out_entries));
+        return count;
+    }
+    return eltt_viewer_build_pool_view(bc, out_entries, max_entries);
+}
+
 /* ----------------------------------------------------------
  * BIP-ähnliche Vorschläge (Governance-Transaktionen)
  * ---------------------------------------------------------- */
@@ -342,7 +574,7 @@ size_t eltt_viewer_collect_bip_like_entries(const eltt_blockchain *bc,
 {
     size_t out_count = 0;
     for (size_t b = 0; b < bc->block_count && out_count < max_entries; ++b) {
-        const eltt_block *blk = &bc->blocks[b];
+        const eltt_block *blk = eltt_blockchain_get_block(bc, b);
         for (size_t t = 0; t < blk->tx_count && out_count < max_entries; ++t) {
             const eltt_transaction *tx = &blk->txs[t];
             if (tx->kind == ELTT_TX_KIND_GOVERNANCE_PROPOSAL) {
@@ -366,20 +598,46 @@ size_t eltt_viewer_collect_wallet_activity(const eltt_blockchain *bc,
                                            uint32_t *out_block_indices,
                                            size_t max_entries)
 {
-    size_t out_count = 0;
-    for (size_t b = 0; b < bc->block_count && out_count < max_entries; ++b) {
-        const eltt_block *blk = &bc->blocks[b];
-        for (size_t t = 0; t < blk->tx_count && out_count < max_entries; ++t) {
-            const eltt_transaction *tx = &blk->txs[t];
-            if (strcmp(tx->from, wallet_address) == 0 ||
-                strcmp(tx->to, wallet_address) == 0) {
-                out_txs[out_count] = *tx;
-                out_block_indices[out_count] = blk->index;
-                out_count++;
-            }
+    /* Delegiert an den Posting-Listen-Index der Engine: es werden nur
+     * die Einträge dieser einen Wallet gelesen, nicht die ganze Chain.
+     * Adressen ohne Wallet (z. B. reine Governance-Absender oder
+     * Explorer-Suchen) fallen auf den Bloom-geführten Chain-Scan
+     * zurück, der die meisten Blöcke per 32-Byte-Vortest überspringt. */
+    if (eltt_viewer_find_wallet_index(bc, wallet_address) < 0) {
+        return eltt_blockchain_scan_address_txs(bc, wallet_address, 0,
+                                                max_entries, out_txs,
+                                                out_block_indices);
+    }
+    return eltt_blockchain_wallet_activity(bc, wallet_address, 0, max_entries,
+                                           out_txs, out_block_indices);
+}
+
+/* Seitenweise Aktivitätsabfrage (limit/offset) über denselben Index;
+ * out_total erhält die Gesamtzahl der Einträge der Wallet. */
+size_t eltt_viewer_collect_wallet_activity_page(const eltt_blockchain *bc,
+                                                const char *wallet_address,
+                                                size_t offset,
+                                                eltt_transaction *out_txs,
+                                                uint32_t *out_block_indices,
+                                                size_t max_entries,
+                                                size_t *out_total)
+{
+    if (eltt_viewer_find_wallet_index(bc, wallet_address) < 0) {
+        /* Für die Gesamtzahl müsste die ganze Chain gescannt werden;
+         * unindizierte Adressen liefern deshalb nur die Seite selbst. */
+        if (out_total) {
+            *out_total = 0;
         }
+        return eltt_blockchain_scan_address_txs(bc, wallet_address, offset,
+                                                max_entries, out_txs,
+                                                out_block_indices);
     }
-    return out_count;
+    if (out_total) {
+        *out_total = eltt_blockchain_wallet_activity_count(bc, wallet_address);
+    }
+    return eltt_blockchain_wallet_activity(bc, wallet_address, offset,
+                                           max_entries, out_txs,
+                                           out_block_indices);
 }
 
 /* ----------------------------------------------------------
@@ -389,12 +647,10 @@ size_t eltt_viewer_collect_wallet_activity(const eltt_blockchain *bc,
 const eltt_block *eltt_viewer_get_block_by_index(const eltt_blockchain *bc,
                                                  uint32_t index)
 {
-    for (size_t i = 0; i < bc->block_count; ++i) {
-        if (bc->blocks[i].index == index) {
-            return &bc->blocks[i];
-        }
-    }
-    return NULL;
+    /* Block-Indizes sind lückenlos aufsteigend (vom Validator erzwungen),
+     * Index und Speicherposition sind daher identisch. Die Zeiger aus dem
+     * segmentierten Speicher bleiben stabil und dürfen gecacht werden. */
+    return eltt_blockchain_get_block(bc, (size_t)index);
 }
 
 const eltt_transaction *eltt_viewer_get_transaction(const eltt_block *block,
@@ -413,6 +669,215 @@ const eltt_transaction *eltt_viewer_get_transaction(const eltt_block *block,
  * Live-Modus (logische Sicht)
  * ---------------------------------------------------------- */
 
+/* ----------------------------------------------------------
+ * Task-paralleler Snapshot
+ *
+ * Die Builder lesen disjunkte Teile der Blockchain und haben keine
+ * Datenabhängigkeiten untereinander; ein voller Dashboard-Refresh kann
+ * sie deshalb als unabhängige Tasks auf einem kleinen, persistenten
+ * Worker-Pool laufen lassen statt seriell auf dem Aufrufer-Thread.
+ * Der Pool wird beim ersten parallelen Snapshot gestartet und lebt bis
+ * zum Prozessende; es darf immer nur ein Snapshot gleichzeitig laufen
+ * (ein Aufrufer-Thread, wie beim Viewer üblich).
+ * ---------------------------------------------------------- */
+
+/* Auftrag eines vollen Snapshots: NULL-Puffer überspringen die
+ * jeweilige Ansicht, die *_count-Felder erhalten die Trefferzahlen. */
+typedef struct {
+    const char *wallet_address;   /* für die wallet-gebundenen Ansichten */
+    eltt_chain_grid_entry *chain_entries;
+    size_t max_chain_entries;
+    size_t chain_count;
+    eltt_pool_view_entry *pool_entries;
+    size_t max_pool_entries;
+    size_t pool_count;
+    eltt_token_position *token_positions;
+    size_t max_token_positions;
+    size_t token_position_count;
+    eltt_lp_position *lp_positions;
+    size_t max_lp_positions;
+    size_t lp_position_count;
+    eltt_staking_view_entry *staking_entries;
+    size_t max_staking_entries;
+    size_t staking_count;
+    eltt_bip_like_entry *bip_entries;
+    size_t max_bip_entries;
+    size_t bip_count;
+    eltt_transaction *activity_txs;
+    uint32_t *activity_block_indices;
+    size_t max_activity_entries;
+    size_t activity_count;
+} eltt_viewer_snapshot_request;
+
+typedef void (*eltt_viewer_task_fn)(const eltt_blockchain *bc,
+                                    eltt_viewer_snapshot_request *req);
+
+static void eltt_viewer_task_chain_grid(const eltt_blockchain *bc,
+                                        eltt_viewer_snapshot_request *req)
+{
+    req->chain_count = eltt_viewer_build_chain_grid(bc, req->chain_entries,
+                                                    req->max_chain_entries);
+}
+
+static void eltt_viewer_task_pool_view(const eltt_blockchain *bc,
+                                       eltt_viewer_snapshot_request *req)
+{
+    req->pool_count = eltt_viewer_build_pool_view(bc, req->pool_entries,
+                                                   req->max_pool_entries);
+}
+
+static void eltt_viewer_task_token_positions(const eltt_blockchain *bc,
+                                             eltt_viewer_snapshot_request *req)
+{
+    req->token_position_count = eltt_viewer_build_token_positions(
+        bc, req->wallet_address, req->token_positions, req->max_token_positions);
+}
+
+static void eltt_viewer_task_lp_positions(const eltt_blockchain *bc,
+                                          eltt_viewer_snapshot_request *req)
+{
+    req->lp_position_count = eltt_viewer_build_lp_positions(
+        bc, req->wallet_address, req->lp_positions, req->max_lp_positions);
+}
+
+static void eltt_viewer_task_staking_view(const eltt_blockchain *bc,
+                                          eltt_viewer_snapshot_request *req)
+{
+    req->staking_count = eltt_viewer_build_staking_view(
+        bc, req->wallet_address, req->staking_entries, req->max_staking_entries);
+}
+
+static void eltt_viewer_task_bip_entries(const eltt_blockchain *bc,
+                                         eltt_viewer_snapshot_request *req)
+{
+    req->bip_count = eltt_viewer_collect_bip_like_entries(
+        bc, req->bip_entries, req->max_bip_entries);
+}
+
+static void eltt_viewer_task_activity(const eltt_blockchain *bc,
+                                      eltt_viewer_snapshot_request *req)
+{
+    req->activity_count = eltt_viewer_collect_wallet_activity(
+        bc, req->wallet_address, req->activity_txs,
+        req->activity_block_indices, req->max_activity_entries);
+}
+
+#define ELTT_VIEWER_POOL_THREADS 4
+#define ELTT_VIEWER_MAX_TASKS    8
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  work_cv;
+    pthread_cond_t  done_cv;
+    int started;            /* Zahl laufender Worker (0 = Pool aus) */
+    int shutdown;
+    const eltt_blockchain *bc;
+    eltt_viewer_snapshot_request *req;
+    eltt_viewer_task_fn tasks[ELTT_VIEWER_MAX_TASKS];
+    size_t task_count;
+    size_t next_task;       /* nächster unvergebener Task */
+    size_t pending;         /* eingeplante, noch nicht fertige Tasks */
+} eltt_viewer_pool = {
+    PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    0, 0, NULL, NULL, {0}, 0, 0, 0
+};
+
+static void *eltt_viewer_pool_worker(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&eltt_viewer_pool.lock);
+    for (;;) {
+        while (!eltt_viewer_pool.shutdown &&
+               eltt_viewer_pool.next_task >= eltt_viewer_pool.task_count) {
+            pthread_cond_wait(&eltt_viewer_pool.work_cv, &eltt_viewer_pool.lock);
+        }
+        if (eltt_viewer_pool.shutdown) {
+            break;
+        }
+        eltt_viewer_task_fn fn = eltt_viewer_pool.tasks[eltt_viewer_pool.next_task++];
+        const eltt_blockchain *bc = eltt_viewer_pool.bc;
+        eltt_viewer_snapshot_request *req = eltt_viewer_pool.req;
+        pthread_mutex_unlock(&eltt_viewer_pool.lock);
+
+        fn(bc, req);
+
+        pthread_mutex_lock(&eltt_viewer_pool.lock);
+        if (--eltt_viewer_pool.pending == 0) {
+            pthread_cond_signal(&eltt_viewer_pool.done_cv);
+        }
+    }
+    pthread_mutex_unlock(&eltt_viewer_pool.lock);
+    return NULL;
+}
+
+/* Startet die Worker beim ersten Aufruf. Liefert die Zahl laufender
+ * Worker; 0 heißt: kein Thread verfügbar, der Aufrufer arbeitet die
+ * Tasks selbst ab. */
+static int eltt_viewer_pool_ensure_started(void)
+{
+    if (eltt_viewer_pool.started > 0) {
+        return eltt_viewer_pool.started;
+    }
+    for (int t = 0; t < ELTT_VIEWER_POOL_THREADS; ++t) {
+        pthread_t tid;
+        if (pthread_create(&tid, NULL, eltt_viewer_pool_worker, NULL) != 0) {
+            break;
+        }
+        pthread_detach(tid);
+        eltt_viewer_pool.started++;
+    }
+    return eltt_viewer_pool.started;
+}
+
+/* Baut alle angeforderten Ansichten eines Snapshots parallel und kehrt
+ * erst zurück, wenn jede fertig ist. Fällt ohne Worker (Thread-Start
+ * fehlgeschlagen) transparent auf die serielle Abarbeitung zurück. */
+void eltt_viewer_live_snapshot_parallel(const eltt_blockchain *bc,
+                                        eltt_viewer_snapshot_request *req)
+{
+    eltt_viewer_task_fn tasks[ELTT_VIEWER_MAX_TASKS];
+    size_t n = 0;
+    if (req->chain_entries)   tasks[n++] = eltt_viewer_task_chain_grid;
+    if (req->pool_entries)    tasks[n++] = eltt_viewer_task_pool_view;
+    if (req->bip_entries)     tasks[n++] = eltt_viewer_task_bip_entries;
+    if (req->wallet_address) {
+        if (req->token_positions) tasks[n++] = eltt_viewer_task_token_positions;
+        if (req->lp_positions)    tasks[n++] = eltt_viewer_task_lp_positions;
+        if (req->staking_entries) tasks[n++] = eltt_viewer_task_staking_view;
+        if (req->activity_txs && req->activity_block_indices) {
+            tasks[n++] = eltt_viewer_task_activity;
+        }
+    }
+    if (n == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&eltt_viewer_pool.lock);
+    if (eltt_viewer_pool_ensure_started() == 0) {
+        pthread_mutex_unlock(&eltt_viewer_pool.lock);
+        for (size_t i = 0; i < n; ++i) {
+            tasks[i](bc, req);
+        }
+        return;
+    }
+
+    eltt_viewer_pool.bc = bc;
+    eltt_viewer_pool.req = req;
+    memcpy(eltt_viewer_pool.tasks, tasks, n * sizeof(tasks[0]));
+    eltt_viewer_pool.task_count = n;
+    eltt_viewer_pool.next_task = 0;
+    eltt_viewer_pool.pending = n;
+    pthread_cond_broadcast(&eltt_viewer_pool.work_cv);
+    while (eltt_viewer_pool.pending > 0) {
+        pthread_cond_wait(&eltt_viewer_pool.done_cv, &eltt_viewer_pool.lock);
+    }
+    eltt_viewer_pool.task_count = 0;
+    eltt_viewer_pool.next_task = 0;
+    pthread_mutex_unlock(&eltt_viewer_pool.lock);
+}
+
 void eltt_viewer_live_snapshot(const eltt_blockchain *bc,
                                eltt_chain_grid_entry *chain_entries,
                                size_t max_chain_entries,
@@ -423,6 +888,34 @@ void eltt_viewer_live_snapshot(const eltt_blockchain *bc,
     eltt_viewer_build_pool_view(bc, pool_entries, max_pool_entries);
 }
 
+/* Abonnement-Variante des Live-Modus: Chain-Grid über Cursor/Delta,
+ * Pool-Ansicht über ihren Generationszähler. Ein Poll-Zyklus ohne neue
+ * Blöcke und ohne Pool-Änderung kostet damit zwei Integer-Vergleiche
+ * statt des kompletten Re-Marshallings beider Ansichten. */
+void eltt_viewer_live_snapshot_delta(const eltt_blockchain *bc,
+                                     uint64_t *chain_generation,
+                                     size_t *chain_cursor,
+                                     eltt_chain_grid_entry *chain_entries,
+                                     size_t max_chain_entries,
+                                     size_t *out_chain_count,
+                                     uint64_t *pool_generation,
+                                     eltt_pool_view_entry *pool_entries,
+                                     size_t max_pool_entries,
+                                     size_t *out_pool_count)
+{
+    size_t n = eltt_viewer_build_chain_grid_delta(bc, chain_generation,
+                                                  chain_cursor, chain_entries,
+                                                  max_chain_entries, NULL);
+    if (out_chain_count) {
+        *out_chain_count = n;
+    }
+    n = eltt_viewer_build_pool_view_delta(bc, pool_generation, pool_entries,
+                                          max_pool_entries, NULL);
+    if (out_pool_count) {
+        *out_pool_count = n;
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,7 +10,8 @@
  * Erstellungsdatum: 2026-02-08
  *
  * Abhängigkeiten (architektonisch):
- *   - Referenziert Root-Engine-APIs (ELTT-Blockchain.c / Engine IPC) extern.
+ *   - Liest den Engine-Zustand über die Shared-Memory-Bridge
+ *     (Seqlock-Segment, publiziert von ELTT-Blockchain.c).
  *   - Validator-Checks sind performance-sensitiv und gehören in validator_wallet.c.
  *
  * Matrix-Rolle:
@@ -32,6 +33,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 /* Minimal ValidationResult-Struct (C) */
 typedef struct {
@@ -48,33 +54,217 @@ static void safe_strncpy(char *dst, const char *src, size_t n) {
     dst[n - 1] = '\0';
 }
 
-/* Placeholder: Engine IPC / data fetch stubs
- * In real deployment these call into the Engine (ELTT-Blockchain.c) or IPC layer.
- * Here they are minimal mocks returning JSON strings for parity testing.
+/* Shared-Memory-Bridge zur Engine
+ *
+ * Die Engine (ELTT-Blockchain.c) exportiert Guthaben, Nonces und die
+ * jüngsten Transaktionen in ein POSIX-Shared-Memory-Segment; dieses
+ * Modul liest direkt daraus, JSON entsteht erst an der Außenkante.
+ * Ein Seqlock sichert die Konsistenz: gelesen wird in einer Schleife,
+ * bis die Sequenznummer vor und nach der Kopie identisch und gerade
+ * war. Layout-Konstanten müssen mit ELTT-Blockchain.c übereinstimmen.
  */
 
-/* Mock: fetch balances as JSON string (caller provides buffer) */
+#define ELTT_MAX_TOKEN_SYMBOL_LEN 16
+#define ELTT_MAX_ADDRESS_LEN      64
+#define ELTT_MAX_TOKEN_TYPES      64
+#define ELTT_MAX_WALLETS          1024
+
+typedef int64_t eltt_amount_fp;
+#define ELTT_FP_SCALE 100000000LL
+
+#define ELTT_BRIDGE_SHM_NAME   "/eltt-wallet-bridge"
+#define ELTT_BRIDGE_MAGIC      0x454c5442u /* "ELTB" */
+#define ELTT_BRIDGE_VERSION    1u
+#define ELTT_BRIDGE_RECENT_TXS 256
+
+typedef struct {
+    char     from[ELTT_MAX_ADDRESS_LEN];
+    char     to[ELTT_MAX_ADDRESS_LEN];
+    double   amount;
+    int32_t  token_index;
+    int32_t  kind;
+    uint32_t block_index;
+    uint64_t timestamp;
+} eltt_bridge_tx;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    _Atomic uint64_t sequence;
+    uint64_t block_count;
+    uint32_t wallet_count;
+    uint32_t token_count;
+    char token_symbols[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_TOKEN_SYMBOL_LEN];
+    char wallet_addresses[ELTT_MAX_WALLETS][ELTT_MAX_ADDRESS_LEN];
+    eltt_amount_fp balances[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_WALLETS];
+    uint64_t nonces[ELTT_MAX_WALLETS];
+    uint32_t recent_count;
+    eltt_bridge_tx recent[ELTT_BRIDGE_RECENT_TXS];
+} eltt_bridge_shm;
+
+static const eltt_bridge_shm *bridge_segment = NULL;
+
+/* Mappt das Segment nur lesend; das Mapping wird gecacht. */
+static const eltt_bridge_shm *bridge_map(void) {
+    if (bridge_segment) return bridge_segment;
+    int fd = shm_open(ELTT_BRIDGE_SHM_NAME, O_RDONLY, 0);
+    if (fd < 0) return NULL;
+    void *p = mmap(NULL, sizeof(eltt_bridge_shm), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return NULL;
+    const eltt_bridge_shm *shm = (const eltt_bridge_shm *)p;
+    if (shm->magic != ELTT_BRIDGE_MAGIC || shm->version != ELTT_BRIDGE_VERSION) {
+        munmap(p, sizeof(eltt_bridge_shm));
+        return NULL;
+    }
+    bridge_segment = shm;
+    return bridge_segment;
+}
+
+/* Seqlock-Leseklammern: begin liefert eine gerade Startsequenz (wartet
+ * ggf. einen laufenden Schreiber ab), retry prüft, ob die Kopie stabil
+ * war. */
+static uint64_t bridge_read_begin(const eltt_bridge_shm *shm) {
+    uint64_t seq;
+    do {
+        seq = atomic_load_explicit(&shm->sequence, memory_order_acquire);
+    } while (seq & 1u);
+    return seq;
+}
+
+static int bridge_read_retry(const eltt_bridge_shm *shm, uint64_t seq) {
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&shm->sequence, memory_order_acquire) != seq;
+}
+
+/* Wallet-Index im Export; -1 falls unbekannt. */
+static int bridge_find_wallet(const eltt_bridge_shm *shm, const char *address,
+                              uint32_t wallet_count) {
+    for (uint32_t i = 0; i < wallet_count; ++i) {
+        if (strncmp(shm->wallet_addresses[i], address, ELTT_MAX_ADDRESS_LEN) == 0)
+            return (int)i;
+    }
+    return -1;
+}
+
+/* Engine-Fetch über die Bridge: Guthaben aller Token als JSON-Objekt.
+ * Kopiert unter Seqlock-Schutz nur die Zeile der einen Wallet. */
 static int engine_fetch_wallet_balances_json(const char *address, char *out_json, size_t out_len) {
     if (address == NULL || strlen(address) == 0) return -1;
-    /* Example JSON: {"ELTT": 123.45, "USDT": 10.0} */
-    int written = snprintf(out_json, out_len, "{\"ELTT\": %.2f, \"USDT\": %.2f}", 123.45, 10.0);
-    return (written < (int)out_len) ? 0 : -2;
+    const eltt_bridge_shm *shm = bridge_map();
+    if (!shm) return -1;
+
+    eltt_amount_fp balances[ELTT_MAX_TOKEN_TYPES];
+    char symbols[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_TOKEN_SYMBOL_LEN];
+    uint32_t token_count;
+    int widx;
+    uint64_t seq;
+    do {
+        seq = bridge_read_begin(shm);
+        token_count = shm->token_count;
+        if (token_count > ELTT_MAX_TOKEN_TYPES) token_count = ELTT_MAX_TOKEN_TYPES;
+        uint32_t wallet_count = shm->wallet_count;
+        if (wallet_count > ELTT_MAX_WALLETS) wallet_count = ELTT_MAX_WALLETS;
+        widx = bridge_find_wallet(shm, address, wallet_count);
+        if (widx >= 0) {
+            for (uint32_t t = 0; t < token_count; ++t) {
+                balances[t] = shm->balances[t][widx];
+                memcpy(symbols[t], shm->token_symbols[t], ELTT_MAX_TOKEN_SYMBOL_LEN);
+            }
+        }
+    } while (bridge_read_retry(shm, seq));
+    if (widx < 0) return -1;
+
+    size_t used = 0;
+    int w = snprintf(out_json + used, out_len - used, "{");
+    if (w < 0 || (size_t)w >= out_len - used) return -2;
+    used += (size_t)w;
+    int first = 1;
+    for (uint32_t t = 0; t < token_count; ++t) {
+        symbols[t][ELTT_MAX_TOKEN_SYMBOL_LEN - 1] = '\0';
+        w = snprintf(out_json + used, out_len - used, "%s\"%s\":%.8f",
+                     first ? "" : ",", symbols[t],
+                     (double)balances[t] / (double)ELTT_FP_SCALE);
+        if (w < 0 || (size_t)w >= out_len - used) return -2;
+        used += (size_t)w;
+        first = 0;
+    }
+    w = snprintf(out_json + used, out_len - used, "}");
+    if (w < 0 || (size_t)w >= out_len - used) return -2;
+    return 0;
 }
 
-/* Mock: fetch transactions as JSON array */
+/* Engine-Fetch über die Bridge: jüngste Transaktionen der Adresse aus
+ * dem Recent-Ring (neueste zuerst, wie exportiert). */
 static int engine_fetch_transactions_json(const char *address, int limit, char *out_json, size_t out_len) {
     if (address == NULL || strlen(address) == 0) return -1;
-    /* Minimal example with one tx; real implementation serializes actual txs */
-    const char *template = "[{\"tx_id\":\"tx123\",\"timestamp\":%ld,\"from\":\"%s\",\"to\":\"%s\",\"amount\":10.0,\"token_symbol\":\"ELTT\",\"fee\":0.01,\"status\":\"confirmed\",\"block_height\":100}]";
-    long ts = time(NULL);
-    int written = snprintf(out_json, out_len, template, ts, address, "dest_address");
-    return (written < (int)out_len) ? 0 : -2;
+    const eltt_bridge_shm *shm = bridge_map();
+    if (!shm) return -1;
+
+    eltt_bridge_tx txs[ELTT_BRIDGE_RECENT_TXS];
+    char symbols[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_TOKEN_SYMBOL_LEN];
+    uint32_t token_count, n = 0;
+    uint64_t seq;
+    do {
+        seq = bridge_read_begin(shm);
+        n = 0;
+        token_count = shm->token_count;
+        if (token_count > ELTT_MAX_TOKEN_TYPES) token_count = ELTT_MAX_TOKEN_TYPES;
+        for (uint32_t t = 0; t < token_count; ++t)
+            memcpy(symbols[t], shm->token_symbols[t], ELTT_MAX_TOKEN_SYMBOL_LEN);
+        uint32_t recent = shm->recent_count;
+        if (recent > ELTT_BRIDGE_RECENT_TXS) recent = ELTT_BRIDGE_RECENT_TXS;
+        for (uint32_t i = 0; i < recent && n < (uint32_t)limit; ++i) {
+            const eltt_bridge_tx *r = &shm->recent[i];
+            if (strncmp(r->from, address, ELTT_MAX_ADDRESS_LEN) == 0 ||
+                strncmp(r->to, address, ELTT_MAX_ADDRESS_LEN) == 0) {
+                txs[n++] = *r;
+            }
+        }
+    } while (bridge_read_retry(shm, seq));
+
+    size_t used = 0;
+    int w = snprintf(out_json + used, out_len - used, "[");
+    if (w < 0 || (size_t)w >= out_len - used) return -2;
+    used += (size_t)w;
+    for (uint32_t i = 0; i < n; ++i) {
+        const eltt_bridge_tx *r = &txs[i];
+        const char *sym = (r->token_index >= 0 &&
+                           (uint32_t)r->token_index < token_count)
+                              ? symbols[r->token_index] : "?";
+        w = snprintf(out_json + used, out_len - used,
+                     "%s{\"tx_id\":\"b%u\",\"timestamp\":%llu,"
+                     "\"from\":\"%s\",\"to\":\"%s\",\"amount\":%.8f,"
+                     "\"token_symbol\":\"%s\",\"fee\":0,"
+                     "\"status\":\"confirmed\",\"block_height\":%u}",
+                     (i == 0) ? "" : ",", r->block_index,
+                     (unsigned long long)r->timestamp, r->from, r->to,
+                     r->amount, sym, r->block_index);
+        if (w < 0 || (size_t)w >= out_len - used) return -2;
+        used += (size_t)w;
+    }
+    w = snprintf(out_json + used, out_len - used, "]");
+    if (w < 0 || (size_t)w >= out_len - used) return -2;
+    return 0;
 }
 
-/* Mock: fetch nonce */
+/* Engine-Fetch über die Bridge: Nonce (Zahl indizierter Transaktionen). */
 static int engine_fetch_nonce_long(const char *address, long *out_nonce) {
     if (address == NULL || out_nonce == NULL) return -1;
-    *out_nonce = 42; /* placeholder */
+    const eltt_bridge_shm *shm = bridge_map();
+    if (!shm) return -1;
+    uint64_t nonce = 0;
+    int widx;
+    uint64_t seq;
+    do {
+        seq = bridge_read_begin(shm);
+        uint32_t wallet_count = shm->wallet_count;
+        if (wallet_count > ELTT_MAX_WALLETS) wallet_count = ELTT_MAX_WALLETS;
+        widx = bridge_find_wallet(shm, address, wallet_count);
+        if (widx >= 0) nonce = shm->nonces[widx];
+    } while (bridge_read_retry(shm, seq));
+    if (widx < 0) return -1;
+    *out_nonce = (long)nonce;
     return 0;
 }
 
@@ -0,0 +1,356 @@
+/* ELTT-Workload.c
+ *
+ * Deterministischer Workload-Generator für Benchmarks und Lasttests.
+ *
+ * Erzeugt aus einem Parametersatz (Seed, Blockzahl, Transaktionen pro
+ * Block, Wallet-Kardinalität, Wiederverwendungsquote der Adressen)
+ * reproduzierbare synthetische Chains. Gleiche Parameter ergeben
+ * bitidentische Blöcke — Staging-Umgebungen können damit exakt die
+ * Last der Benchmarks nachfahren.
+ *
+ * Keine UI, keine Beispiele; nutzbar als Bibliothek (ELTT-Bench.c)
+ * und aus eigenen Harnessen.
+ */
+
+#ifndef ELTT_WORKLOAD_H
+#define ELTT_WORKLOAD_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+/* ----------------------------------------------------------
+ * Gemeinsame Typen (müssen mit ELTT-Blockchain.c übereinstimmen)
+ * ---------------------------------------------------------- */
+
+#define ELTT_MAX_TOKEN_SYMBOL_LEN 16
+#define ELTT_MAX_TOKEN_NAME_LEN   64
+#define ELTT_MAX_ADDRESS_LEN      64
+#define ELTT_MAX_MEMO_LEN         128
+#define ELTT_MAX_TOKEN_TYPES      64
+#define ELTT_MAX_TX_PER_BLOCK     256
+#define ELTT_MAX_WALLETS          1024
+#define ELTT_MAX_POOLS            256
+#define ELTT_MAX_STAKES           1024
+#define ELTT_WALLET_INDEX_CAP     2048
+#define ELTT_INTERN_MAX_IDS       16384
+
+/* Festkomma-Guthaben: muss mit ELTT-Blockchain.c übereinstimmen. */
+typedef int64_t eltt_amount_fp;
+#define ELTT_FP_SCALE 100000000LL
+#define ELTT_BLOCKS_PER_CHUNK     64
+#define ELTT_MAX_BLOCK_CHUNKS     8192
+#define ELTT_TX_CHUNK_CAP         4096
+#define ELTT_MAX_TX_CHUNKS        4096
+
+typedef enum {
+    ELTT_TOKEN_KIND_TTTC,
+    ELTT_TOKEN_KIND_ELTT,
+    ELTT_TOKEN_KIND_ELTC,
+    ELTT_TOKEN_KIND_GENERIC,
+    ELTT_TOKEN_KIND_LP
+} eltt_token_kind;
+
+typedef struct {
+    char  name[ELTT_MAX_TOKEN_NAME_LEN];
+    char  symbol[ELTT_MAX_TOKEN_SYMBOL_LEN];
+    int   decimals;
+    eltt_token_kind kind;
+    double energy_binding_factor;
+} eltt_token_type;
+
+typedef struct {
+    char  address[ELTT_MAX_ADDRESS_LEN];
+} eltt_wallet;
+
+typedef enum {
+    ELTT_TX_KIND_TRANSFER,
+    ELTT_TX_KIND_MINT,
+    ELTT_TX_KIND_BURN,
+    ELTT_TX_KIND_CREATE_TOKEN,
+    ELTT_TX_KIND_CREATE_POOL,
+    ELTT_TX_KIND_ADD_LIQUIDITY,
+    ELTT_TX_KIND_REMOVE_LIQUIDITY,
+    ELTT_TX_KIND_STAKE,
+    ELTT_TX_KIND_UNSTAKE,
+    ELTT_TX_KIND_CLAIM_REWARDS,
+    ELTT_TX_KIND_SWAP,
+    ELTT_TX_KIND_PROFILE_UPDATE,
+    ELTT_TX_KIND_GOVERNANCE_PROPOSAL
+} eltt_tx_kind;
+
+typedef struct {
+    char  from[ELTT_MAX_ADDRESS_LEN];
+    char  to[ELTT_MAX_ADDRESS_LEN];
+    double amount;
+    int   token_index;
+    eltt_tx_kind kind;
+    char  memo[ELTT_MAX_MEMO_LEN];
+    /* Interning-Cache (siehe ELTT-Blockchain.c): prozess-lokal,
+     * nicht Teil des Wire-Formats; 0 = nicht interniert. */
+    uint32_t from_id;
+    uint32_t to_id;
+} eltt_transaction;
+
+typedef struct {
+    uint32_t index;
+    uint64_t timestamp;
+    uint8_t  prev_hash[32];
+    uint8_t  hash[32];
+    /* Merkle-Wurzel über die serialisierten Transaktionen des Blocks */
+    uint8_t  merkle_root[32];
+    size_t   tx_count;
+    eltt_transaction *txs;
+} eltt_block;
+
+typedef struct {
+    int token_x_index;
+    int token_y_index;
+    double reserve_x;
+    double reserve_y;
+    int lp_token_index;
+} eltt_liquidity_pool;
+
+typedef struct {
+    char  owner[ELTT_MAX_ADDRESS_LEN];
+    int   token_index;
+    double amount;
+    uint64_t start_timestamp;
+    uint64_t lock_until;
+    double accumulated_rewards;
+    /* Akkumulator-Snapshot, siehe ELTT-Blockchain.c */
+    double reward_per_token_snap;
+} eltt_staking_position;
+
+/* Teilzustände mit eigenem Generationszähler (muss mit
+ * ELTT-Blockchain.c übereinstimmen). */
+typedef enum {
+    ELTT_VIEW_CHAIN = 0,
+    ELTT_VIEW_WALLETS,
+    ELTT_VIEW_POOLS,
+    ELTT_VIEW_STAKES,
+    ELTT_VIEW_COUNT
+} eltt_view_kind;
+
+/* Materialisierte Pool-Ansicht (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    int pool_index;
+    int token_x_index;
+    int token_y_index;
+    double reserve_x;
+    double reserve_y;
+    int lp_token_index;
+} eltt_pool_view_entry;
+
+/* Posting-Liste für Wallet-Aktivität
+ * (muss mit ELTT-Blockchain.c übereinstimmen). */
+typedef struct {
+    uint32_t block_index;
+    uint32_t tx_index;
+} eltt_tx_ref;
+
+typedef struct {
+    size_t count;
+    size_t cap;
+    eltt_tx_ref *refs;
+} eltt_activity_list;
+
+typedef struct {
+    size_t block_count;
+    eltt_block *block_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    uint8_t *bloom_chunks[ELTT_MAX_BLOCK_CHUNKS];
+    size_t tx_chunk_count;
+    size_t tx_chunk_used;
+    eltt_transaction *tx_chunks[ELTT_MAX_TX_CHUNKS];
+    size_t wallet_count;
+    eltt_wallet wallets[ELTT_MAX_WALLETS];
+    /* Guthaben token-major (Struct-of-Arrays), siehe ELTT-Blockchain.c */
+    eltt_amount_fp wallet_balances[ELTT_MAX_TOKEN_TYPES][ELTT_MAX_WALLETS];
+    size_t token_count;
+    eltt_token_type token_types[ELTT_MAX_TOKEN_TYPES];
+    size_t pool_count;
+    eltt_liquidity_pool pools[ELTT_MAX_POOLS];
+    size_t stake_count;
+    eltt_staking_position stakes[ELTT_MAX_STAKES];
+    /* Staking-Reward-Akkumulatoren, siehe ELTT-Blockchain.c */
+    double   stake_reward_per_token[ELTT_MAX_TOKEN_TYPES];
+    uint64_t stake_accrual_timestamp;
+    int32_t wallet_index_map[ELTT_WALLET_INDEX_CAP];
+    /* Direkt-Map Intern-ID -> Wallet-Index, siehe ELTT-Blockchain.c */
+    int32_t id_to_wallet[ELTT_INTERN_MAX_IDS + 1];
+    /* Generationszähler und materialisierte Pool-Ansicht,
+     * siehe ELTT-Blockchain.c */
+    uint64_t view_generations[ELTT_VIEW_COUNT];
+    size_t pool_view_count;
+    eltt_pool_view_entry pool_view[ELTT_MAX_POOLS];
+    /* Aktivitäts-Index, siehe ELTT-Blockchain.c */
+    eltt_activity_list activity[ELTT_MAX_WALLETS];
+} eltt_blockchain;
+
+/* ----------------------------------------------------------
+ * Externe Funktionen aus ELTT-Blockchain.c
+ * ---------------------------------------------------------- */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void eltt_blockchain_init(eltt_blockchain *bc);
+void eltt_blockchain_create_genesis(eltt_blockchain *bc,
+                                    const char *owner_address,
+                                    uint64_t timestamp);
+int  eltt_blockchain_add_block(eltt_blockchain *bc, const eltt_block *block);
+void eltt_blockchain_compute_block_hash(eltt_block *block);
+const eltt_block *eltt_blockchain_get_block(const eltt_blockchain *bc, size_t i);
+
+/* ----------------------------------------------------------
+ * Workload-Parameter
+ * ---------------------------------------------------------- */
+
+typedef struct {
+    uint64_t seed;               /* bestimmt die gesamte Sequenz */
+    size_t   block_count;        /* Blöcke ohne Genesis */
+    size_t   txs_per_block;      /* <= ELTT_MAX_TX_PER_BLOCK */
+    size_t   wallet_cardinality; /* Zahl verschiedener Adressen */
+    double   address_reuse_ratio;/* 0..1: Anteil der Transaktionen auf
+                                  * einem kleinen "heißen" Adresskern */
+} eltt_workload_params;
+
+/* ----------------------------------------------------------
+ * Deterministischer PRNG (splitmix64)
+ * ---------------------------------------------------------- */
+
+static uint64_t eltt_workload_mix(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/* Wallet-Nummer für Transaktion t in Block b: mit Wahrscheinlichkeit
+ * address_reuse_ratio aus dem heißen Kern (1/16 der Kardinalität),
+ * sonst gleichverteilt über alle Adressen. */
+static size_t eltt_workload_pick_wallet(const eltt_workload_params *p,
+                                        uint64_t stream, int which)
+{
+    size_t cardinality = (p->wallet_cardinality > 0) ? p->wallet_cardinality : 1;
+    size_t hot = cardinality / 16;
+    if (hot == 0) {
+        hot = 1;
+    }
+    uint64_t r = eltt_workload_mix(stream * 4ULL + (uint64_t)which);
+    double coin = (double)(r >> 11) / 9007199254740992.0; /* [0,1) */
+    uint64_t r2 = eltt_workload_mix(r);
+    if (coin < p->address_reuse_ratio) {
+        return (size_t)(r2 % hot);
+    }
+    return (size_t)(r2 % cardinality);
+}
+
+/* ----------------------------------------------------------
+ * Generator
+ * ---------------------------------------------------------- */
+
+/* Zahl der Aufwärm-Blöcke, die alle Wallets per PROFILE_UPDATE
+ * anlegen. MINT wird gegen den Zustand VOR dem Block validiert;
+ * erst nach dem Aufwärmen darf der Generator frei minten. */
+static size_t eltt_workload_warmup_blocks(const eltt_workload_params *p)
+{
+    size_t per_block = p->txs_per_block;
+    if (per_block == 0) {
+        per_block = 1;
+    }
+    if (per_block > ELTT_MAX_TX_PER_BLOCK) {
+        per_block = ELTT_MAX_TX_PER_BLOCK;
+    }
+    size_t cardinality = (p->wallet_cardinality > 0) ? p->wallet_cardinality : 1;
+    return (cardinality + per_block - 1) / per_block;
+}
+
+/* Füllt die Transaktionen für Block block_index (1-basiert, Genesis
+ * ist Block 0) deterministisch aus den Parametern. */
+void eltt_workload_block_txs(const eltt_workload_params *p,
+                             size_t block_index,
+                             eltt_transaction *out_txs,
+                             size_t *out_count)
+{
+    size_t tx_count = p->txs_per_block;
+    if (tx_count > ELTT_MAX_TX_PER_BLOCK) {
+        tx_count = ELTT_MAX_TX_PER_BLOCK;
+    }
+    size_t warmup = eltt_workload_warmup_blocks(p);
+    size_t cardinality = (p->wallet_cardinality > 0) ? p->wallet_cardinality : 1;
+    if (block_index <= warmup) {
+        /* Aufwärmphase: Wallets in deterministischer Reihenfolge
+         * anlegen, überzählige Transaktionen wickeln modulo um. */
+        for (size_t t = 0; t < tx_count; ++t) {
+            eltt_transaction *tx = &out_txs[t];
+            memset(tx, 0, sizeof(*tx));
+            size_t w = ((block_index - 1) * tx_count + t) % cardinality;
+            snprintf(tx->from, sizeof(tx->from), "wallet-%zu", w);
+            snprintf(tx->to, sizeof(tx->to), "wallet-%zu", w);
+            tx->kind = ELTT_TX_KIND_PROFILE_UPDATE;
+            snprintf(tx->memo, sizeof(tx->memo), "wl-warmup-%zu-%zu",
+                     block_index, t);
+        }
+        *out_count = tx_count;
+        return;
+    }
+    for (size_t t = 0; t < tx_count; ++t) {
+        eltt_transaction *tx = &out_txs[t];
+        memset(tx, 0, sizeof(*tx));
+        uint64_t stream = eltt_workload_mix(p->seed ^ (uint64_t)block_index) +
+                          (uint64_t)t * 0x9e3779b97f4a7c15ULL;
+        size_t from_w = eltt_workload_pick_wallet(p, stream, 0);
+        size_t to_w   = eltt_workload_pick_wallet(p, stream, 1);
+        snprintf(tx->from, sizeof(tx->from), "wallet-%zu", from_w);
+        snprintf(tx->to, sizeof(tx->to), "wallet-%zu", to_w);
+        /* PROFILE_UPDATE ist zustandsneutral gültig, MINT erhöht
+         * Guthaben: abwechselnd, damit Apply-Pfad und Wallet-Anlage
+         * beide unter Last stehen. */
+        if ((eltt_workload_mix(stream) & 3ULL) == 0ULL) {
+            tx->kind = ELTT_TX_KIND_PROFILE_UPDATE;
+        } else {
+            tx->kind = ELTT_TX_KIND_MINT;
+            tx->amount = (double)((eltt_workload_mix(stream + 1) % 1000ULL) + 1ULL);
+            tx->token_index = (int)(eltt_workload_mix(stream + 2) % 3ULL);
+        }
+        snprintf(tx->memo, sizeof(tx->memo), "wl-%zu-%zu", block_index, t);
+    }
+    *out_count = tx_count;
+}
+
+/* Baut die komplette synthetische Chain (Genesis + block_count Blöcke)
+ * über den normalen Validierungs-/Apply-Pfad auf.
+ * Gibt 1 bei Erfolg zurück, sonst 0. */
+int eltt_workload_build_chain(const eltt_workload_params *p, eltt_blockchain *bc)
+{
+    eltt_blockchain_init(bc);
+    eltt_blockchain_create_genesis(bc, "workload-owner", 1000000);
+
+    eltt_transaction txs[ELTT_MAX_TX_PER_BLOCK];
+    for (size_t i = 1; i <= p->block_count; ++i) {
+        eltt_block b;
+        memset(&b, 0, sizeof(b));
+        b.index = (uint32_t)i;
+        b.timestamp = 1000000 + (uint64_t)i;
+        memcpy(b.prev_hash, eltt_blockchain_get_block(bc, i - 1)->hash, 32);
+        eltt_workload_block_txs(p, i, txs, &b.tx_count);
+        b.txs = txs;
+        eltt_blockchain_compute_block_hash(&b);
+        if (!eltt_blockchain_add_block(bc, &b)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELTT_WORKLOAD_H */
+
+/* Ende: Root/ELTT-Workload.c */
@@ -24,12 +24,18 @@
  *   int parity_fetch_all_pools(char *out_json, size_t out_len);
  *   int parity_fetch_pool(const char *pool_id, char *out_json, size_t out_len);
  *   int parity_compute_pool_metrics(const char *pool_json, char *out_json, size_t out_len);
+ *   int parity_compute_all_pool_metrics(char *out_json, size_t out_len);
+ *   int parity_fetch_pool_metrics_summary(char *out_json, size_t out_len);
+ *   int parity_write_pools_json(const eltt_liquidity_pool *pools, size_t pool_count,
+ *                               eltt_json_writer *w);
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <math.h>
+#include <time.h>
 
 #ifndef ELTT_LIQUIDTITY_POOLS_H
 #define ELTT_LIQUIDTITY_POOLS_H
@@ -61,8 +67,31 @@ typedef struct {
     eltt_liquidity_pool pools[ELTT_MAX_POOLS];
 } eltt_pool_state;
 
-/* Diese Funktion wird typischerweise aus ELTT-Blockchain.c bereitgestellt */
+/* Diese Funktionen werden typischerweise aus ELTT-Blockchain.c bereitgestellt.
+ * Die Generation zählt Pool-berührende Transaktionen (ELTT_VIEW_POOLS);
+ * der Metrics-Cache unten wird nur bei geänderter Generation neu gerechnet. */
 extern int eltt_blockchain_fetch_pool_state(eltt_pool_state *out_state);
+extern int eltt_blockchain_fetch_pool_generation(uint64_t *out_generation);
+
+/* -------------------------------------------------------------------------
+ * JSON-Writer (muss mit ELTT-Json-Writer.c übereinstimmen)
+ * ------------------------------------------------------------------------- */
+
+typedef struct {
+    char  *buf;
+    size_t len;
+    size_t cap;
+    int    owns_buf;
+    int    error;
+} eltt_json_writer;
+
+extern void eltt_json_writer_init_fixed(eltt_json_writer *w, char *buf, size_t cap);
+extern int  eltt_json_writer_ok(const eltt_json_writer *w);
+extern void eltt_json_append_raw(eltt_json_writer *w, const char *s);
+extern void eltt_json_append_char(eltt_json_writer *w, char c);
+extern void eltt_json_field_string(eltt_json_writer *w, const char *key, const char *value);
+extern void eltt_json_field_int(eltt_json_writer *w, const char *key, long long v);
+extern void eltt_json_field_double(eltt_json_writer *w, const char *key, double v);
 
 /* -------------------------------------------------------------------------
  * Interne Helper
@@ -79,57 +108,205 @@ static void safe_copy(char *dst, const char *src, size_t n) {
  * JSON-Serialisierung (minimal, ohne externe Lib)
  * ------------------------------------------------------------------------- */
 
-static int write_all_pools_json(const eltt_pool_state *state, char *out_json, size_t out_len) {
-    if (!out_json || out_len == 0) return -1;
-    size_t used = 0;
-    int n = snprintf(out_json + used, out_len - used, "[");
-    if (n < 0 || (size_t)n >= out_len - used) return -2;
-    used += (size_t)n;
-
-    for (size_t i = 0; i < state->pool_count; ++i) {
-        const eltt_liquidity_pool *p = &state->pools[i];
-        n = snprintf(
-            out_json + used,
-            out_len - used,
-            "%s{\"pool_id\":\"%s\",\"token_a_index\":%d,\"token_b_index\":%d,"
-            "\"reserve_a\":%.10g,\"reserve_b\":%.10g,"
-            "\"lp_token_index\":%d,\"fee_bps\":%d}",
-            (i == 0 ? "" : ","),
-            p->pool_id,
-            p->token_x_index,
-            p->token_y_index,
-            p->reserve_x,
-            p->reserve_y,
-            p->lp_token_index,
-            p->fee_bps
-        );
-        if (n < 0 || (size_t)n >= out_len - used) return -2;
-        used += (size_t)n;
-    }
-
-    n = snprintf(out_json + used, out_len - used, "]");
-    if (n < 0 || (size_t)n >= out_len - used) return -2;
-    used += (size_t)n;
+static void write_pool_object(eltt_json_writer *w, const eltt_liquidity_pool *p) {
+    eltt_json_append_char(w, '{');
+    eltt_json_field_string(w, "pool_id", p->pool_id);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "token_a_index", p->token_x_index);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "token_b_index", p->token_y_index);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "reserve_a", p->reserve_x);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "reserve_b", p->reserve_y);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "lp_token_index", p->lp_token_index);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_int(w, "fee_bps", p->fee_bps);
+    eltt_json_append_char(w, '}');
+}
+
+/* Serialisiert ein Pool-Array direkt in den Writer — ohne den Umweg
+ * über eine eltt_pool_state-Kopie; nutzbar auch von Aufrufern, die
+ * die Engine-Pools bereits in der Hand halten. */
+int parity_write_pools_json(const eltt_liquidity_pool *pools, size_t pool_count,
+                            eltt_json_writer *w) {
+    eltt_json_append_char(w, '[');
+    for (size_t i = 0; i < pool_count; ++i) {
+        if (i > 0) eltt_json_append_char(w, ',');
+        write_pool_object(w, &pools[i]);
+    }
+    eltt_json_append_char(w, ']');
+    return eltt_json_writer_ok(w) ? 0 : -2;
+}
+
+/* -------------------------------------------------------------------------
+ * Metrics-Engine (SoA)
+ *
+ * Berechnet Spot-Preis, TVL, 1%-Tiefe und Fee-APR für alle Pools in
+ * einem Durchlauf. Die Reserven werden dafür einmal aus dem Pool-Array
+ * (AoS) in flache Spalten (SoA) umkopiert; die eigentliche Arithmetik
+ * läuft dann in einfachen, vektorisierbaren Schleifen über die Spalten.
+ *
+ * Ohne Preis-Oracle sind TVL und Tiefe in Einheiten von Token B
+ * angegeben: am Spot-Preis ist die A-Reserve genau reserve_b wert,
+ * also tvl_b = 2 * reserve_b. Die 1%-Tiefe ist die Menge, die den
+ * Spot-Preis eines Constant-Product-Pools um 1 % verschiebt.
+ *
+ * Fee-APR kommt ohne externen Volumen-Feed aus: bei x*y=k-Pools
+ * schlagen sich Gebühren als Wachstum von sqrt(k) nieder. Der Cache
+ * merkt sich sqrt(k) und den Abtastzeitpunkt je Pool und rechnet das
+ * Wachstum seit dem letzten Refresh auf ein Jahr hoch.
+ * ------------------------------------------------------------------------- */
+
+#define ELTT_POOL_SECONDS_PER_YEAR 31536000.0
+
+typedef struct {
+    int      valid;
+    uint64_t generation;
+    size_t   count;
+    char     pool_ids[ELTT_MAX_POOLS][ELTT_MAX_POOL_ID_LEN];
+    double   price_a_per_b[ELTT_MAX_POOLS];
+    double   price_b_per_a[ELTT_MAX_POOLS];
+    double   tvl_b[ELTT_MAX_POOLS];
+    double   depth_a_1pct[ELTT_MAX_POOLS];
+    double   depth_b_1pct[ELTT_MAX_POOLS];
+    double   fee_rate[ELTT_MAX_POOLS];
+    double   fee_apr[ELTT_MAX_POOLS];
+    double   sqrt_k[ELTT_MAX_POOLS];
+    long long sampled_at[ELTT_MAX_POOLS];
+    double   tvl_b_total;
+    double   fee_apr_tvl_weighted;
+} eltt_pool_metrics_cache;
+
+static eltt_pool_metrics_cache pool_metrics_cache;
+
+static void pool_metrics_recompute(const eltt_pool_state *state,
+                                   uint64_t generation) {
+    eltt_pool_metrics_cache *c = &pool_metrics_cache;
+    static double rx[ELTT_MAX_POOLS];
+    static double ry[ELTT_MAX_POOLS];
+    size_t n = state->pool_count;
+    if (n > ELTT_MAX_POOLS) n = ELTT_MAX_POOLS;
+
+    /* AoS -> SoA: ein Durchlauf über das Pool-Array, danach nur noch
+     * Spalten-Arithmetik. */
+    for (size_t i = 0; i < n; ++i) {
+        rx[i] = state->pools[i].reserve_x;
+        ry[i] = state->pools[i].reserve_y;
+        c->fee_rate[i] = (double)state->pools[i].fee_bps / 10000.0;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        c->price_a_per_b[i] = (ry[i] > 0.0) ? rx[i] / ry[i] : 0.0;
+        c->price_b_per_a[i] = (rx[i] > 0.0) ? ry[i] / rx[i] : 0.0;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        c->tvl_b[i] = 2.0 * ry[i];
+    }
+    /* 1%-Tiefe: sqrt(1.01)-1 auf der B-Seite, 1-1/sqrt(1.01) auf der
+     * A-Seite (Constant Product, exakt). */
+    {
+        const double up = sqrt(1.01) - 1.0;
+        const double down = 1.0 - 1.0 / sqrt(1.01);
+        for (size_t i = 0; i < n; ++i) {
+            c->depth_b_1pct[i] = ry[i] * up;
+            c->depth_a_1pct[i] = rx[i] * down;
+        }
+    }
+
+    /* Fee-APR über sqrt(k)-Wachstum seit dem letzten Refresh; ein
+     * Pool, der seitdem keine Gebühren verdient hat, liegt bei 0. */
+    long long now = (long long)time(NULL);
+    for (size_t i = 0; i < n; ++i) {
+        double sk = sqrt(rx[i] * ry[i]);
+        double apr = 0.0;
+        if (c->valid && i < c->count &&
+            strcmp(c->pool_ids[i], state->pools[i].pool_id) == 0 &&
+            c->sqrt_k[i] > 0.0 && sk > c->sqrt_k[i] &&
+            now > c->sampled_at[i]) {
+            double growth = sk / c->sqrt_k[i] - 1.0;
+            apr = growth / (double)(now - c->sampled_at[i]) *
+                  ELTT_POOL_SECONDS_PER_YEAR;
+        }
+        c->fee_apr[i] = apr;
+        c->sqrt_k[i] = sk;
+        c->sampled_at[i] = now;
+        safe_copy(c->pool_ids[i], state->pools[i].pool_id, ELTT_MAX_POOL_ID_LEN);
+    }
+
+    double tvl_total = 0.0;
+    double apr_weighted = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        tvl_total += c->tvl_b[i];
+        apr_weighted += c->fee_apr[i] * c->tvl_b[i];
+    }
+    c->tvl_b_total = tvl_total;
+    c->fee_apr_tvl_weighted = (tvl_total > 0.0) ? apr_weighted / tvl_total : 0.0;
+
+    c->count = n;
+    c->generation = generation;
+    c->valid = 1;
+}
+
+/* Holt Pool-Zustand und Generation und rechnet den Cache nur neu,
+ * wenn seit dem letzten Lauf eine Pool-berührende Transaktion
+ * angewendet wurde. Gibt 0 bei Erfolg zurück. */
+static int pool_metrics_refresh(void) {
+    eltt_pool_state state;
+    memset(&state, 0, sizeof(state));
+    if (eltt_blockchain_fetch_pool_state(&state) != 0) {
+        return -2;
+    }
+    uint64_t generation = 0;
+    if (eltt_blockchain_fetch_pool_generation(&generation) != 0) {
+        /* Ohne Generationszähler immer neu rechnen. */
+        generation = pool_metrics_cache.generation + 1;
+    }
+    if (!pool_metrics_cache.valid ||
+        generation != pool_metrics_cache.generation) {
+        pool_metrics_recompute(&state, generation);
+    }
     return 0;
 }
 
-static int write_single_pool_json(const eltt_liquidity_pool *p, char *out_json, size_t out_len) {
-    if (!p || !out_json || out_len == 0) return -1;
-    int n = snprintf(
-        out_json,
-        out_len,
-        "{\"pool_id\":\"%s\",\"token_a_index\":%d,\"token_b_index\":%d,"
-        "\"reserve_a\":%.10g,\"reserve_b\":%.10g,"
-        "\"lp_token_index\":%d,\"fee_bps\":%d}",
-        p->pool_id,
-        p->token_x_index,
-        p->token_y_index,
-        p->reserve_x,
-        p->reserve_y,
-        p->lp_token_index,
-        p->fee_bps
-    );
-    return (n >= 0 && (size_t)n < out_len) ? 0 : -2;
+static void write_pool_metrics_object(eltt_json_writer *w,
+                                      const eltt_pool_metrics_cache *c,
+                                      size_t i) {
+    eltt_json_append_char(w, '{');
+    eltt_json_field_string(w, "pool_id", c->pool_ids[i]);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "price_a_per_b", c->price_a_per_b[i]);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "price_b_per_a", c->price_b_per_a[i]);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "tvl_b", c->tvl_b[i]);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "depth_a_1pct", c->depth_a_1pct[i]);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "depth_b_1pct", c->depth_b_1pct[i]);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "fee_rate", c->fee_rate[i]);
+    eltt_json_append_char(w, ',');
+    eltt_json_field_double(w, "fee_apr", c->fee_apr[i]);
+    eltt_json_append_char(w, '}');
+}
+
+/* Liest ein numerisches Feld aus flachem JSON ("key":zahl). Reicht für
+ * die von write_pool_object() erzeugten Objekte; kein voller Parser. */
+static int json_number_field(const char *json, const char *key, double *out) {
+    char pattern[64];
+    int n = snprintf(pattern, sizeof(pattern), "\"%s\"", key);
+    if (n < 0 || (size_t)n >= sizeof(pattern)) return -1;
+    const char *p = strstr(json, pattern);
+    if (!p) return -1;
+    p += n;
+    while (*p == ' ' || *p == ':') p++;
+    char *end = NULL;
+    double v = strtod(p, &end);
+    if (end == p) return -1;
+    *out = v;
+    return 0;
 }
 
 /* -------------------------------------------------------------------------
@@ -144,7 +321,9 @@ int parity_fetch_all_pools(char *out_json, size_t out_len) {
         safe_copy(out_json, "[]", out_len);
         return -2;
     }
-    return write_all_pools_json(&state, out_json, out_len);
+    eltt_json_writer w;
+    eltt_json_writer_init_fixed(&w, out_json, out_len);
+    return parity_write_pools_json(state.pools, state.pool_count, &w);
 }
 
 int parity_fetch_pool(const char *pool_id, char *out_json, size_t out_len) {
@@ -157,26 +336,87 @@ int parity_fetch_pool(const char *pool_id, char *out_json, size_t out_len) {
     }
     for (size_t i = 0; i < state.pool_count; ++i) {
         if (strcmp(state.pools[i].pool_id, pool_id) == 0) {
-            return write_single_pool_json(&state.pools[i], out_json, out_len);
+            eltt_json_writer w;
+            eltt_json_writer_init_fixed(&w, out_json, out_len);
+            write_pool_object(&w, &state.pools[i]);
+            return eltt_json_writer_ok(&w) ? 0 : -2;
         }
     }
     safe_copy(out_json, "{}", out_len);
     return 0;
 }
 
-/* Sehr einfacher Metrics-Stub: berechnet nur price_a_per_b / price_b_per_a aus JSON-Input.
- * In echter Implementierung würde hier JSON geparst; hier nur Platzhalter.
- */
+/* Metriken für einen einzelnen Pool aus seinem JSON-Objekt (Format von
+ * write_pool_object). Kein APR: der braucht die sqrt(k)-Historie des
+ * Caches; Einzel-Pool-Aufrufer bekommen ihn über
+ * parity_compute_all_pool_metrics(). */
 int parity_compute_pool_metrics(const char *pool_json, char *out_json, size_t out_len) {
-    (void)pool_json;
+    if (!pool_json || !out_json || out_len == 0) return -1;
+    double ra = 0.0, rb = 0.0, fee_bps = 0.0;
+    if (json_number_field(pool_json, "reserve_a", &ra) != 0 ||
+        json_number_field(pool_json, "reserve_b", &rb) != 0) {
+        return -2;
+    }
+    (void)json_number_field(pool_json, "fee_bps", &fee_bps);
+
+    eltt_json_writer w;
+    eltt_json_writer_init_fixed(&w, out_json, out_len);
+    eltt_json_append_char(&w, '{');
+    eltt_json_field_double(&w, "price_a_per_b", (rb > 0.0) ? ra / rb : 0.0);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "price_b_per_a", (ra > 0.0) ? rb / ra : 0.0);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "tvl_b", 2.0 * rb);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "depth_a_1pct", ra * (1.0 - 1.0 / sqrt(1.01)));
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "depth_b_1pct", rb * (sqrt(1.01) - 1.0));
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "fee_rate", fee_bps / 10000.0);
+    eltt_json_append_char(&w, '}');
+    return eltt_json_writer_ok(&w) ? 0 : -2;
+}
+
+/* Metriken aller Pools als JSON-Array, aus dem Cache; neu gerechnet
+ * wird nur, wenn die Pool-Generation sich geändert hat. */
+int parity_compute_all_pool_metrics(char *out_json, size_t out_len) {
     if (!out_json || out_len == 0) return -1;
-    /* Stub: liefert neutrale Dummy-Metriken */
-    int n = snprintf(
-        out_json,
-        out_len,
-        "{\"price_a_per_b\":null,\"price_b_per_a\":null,\"tvl_usd\":null,\"lp_share_value_usd\":null}"
-    );
-    return (n >= 0 && (size_t)n < out_len) ? 0 : -2;
+    if (pool_metrics_refresh() != 0) {
+        safe_copy(out_json, "[]", out_len);
+        return -2;
+    }
+    eltt_json_writer w;
+    eltt_json_writer_init_fixed(&w, out_json, out_len);
+    eltt_json_append_char(&w, '[');
+    for (size_t i = 0; i < pool_metrics_cache.count; ++i) {
+        if (i > 0) eltt_json_append_char(&w, ',');
+        write_pool_metrics_object(&w, &pool_metrics_cache, i);
+    }
+    eltt_json_append_char(&w, ']');
+    return eltt_json_writer_ok(&w) ? 0 : -2;
+}
+
+/* Aggregierte Sicht über alle Pools (Gesamt-TVL in Token-B-Einheiten,
+ * TVL-gewichteter Fee-APR) aus demselben Cache. */
+int parity_fetch_pool_metrics_summary(char *out_json, size_t out_len) {
+    if (!out_json || out_len == 0) return -1;
+    if (pool_metrics_refresh() != 0) {
+        safe_copy(out_json, "{}", out_len);
+        return -2;
+    }
+    eltt_json_writer w;
+    eltt_json_writer_init_fixed(&w, out_json, out_len);
+    eltt_json_append_char(&w, '{');
+    eltt_json_field_int(&w, "pool_count", (long long)pool_metrics_cache.count);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "tvl_b_total", pool_metrics_cache.tvl_b_total);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_double(&w, "fee_apr_tvl_weighted",
+                           pool_metrics_cache.fee_apr_tvl_weighted);
+    eltt_json_append_char(&w, ',');
+    eltt_json_field_int(&w, "generation", (long long)pool_metrics_cache.generation);
+    eltt_json_append_char(&w, '}');
+    return eltt_json_writer_ok(&w) ? 0 : -2;
 }
 
 #ifdef __cplusplus